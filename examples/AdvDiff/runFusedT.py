@@ -0,0 +1,94 @@
+#! /usr/bin/env python
+
+# Runs AdvDiff in both augmented forms with the evaluator graph and with the
+# fused residual evaluator, checks that the two paths give the same final
+# solution and reports the speedup of the residual and Jacobian fills.
+
+import sys
+import os
+import re
+import json
+from subprocess import Popen
+
+tolerance = 1.0e-10
+fills = ["> Albany Fill: Residual", "> Albany Fill: Jacobian"]
+
+paths = [ ["graph", "inputT.xml"],
+          ["fused", "inputT_Fused.xml"] ]
+
+def write_input(base, form, tag):
+    text = open(base).read()
+    text = re.sub(r'(name="Augmented Form Type" type="int" value=")\d+',
+                  r'\g<1>%d' % form, text)
+    text = text.replace('<ParameterList name="Debug Output">',
+        '<ParameterList name="Debug Output">\n' +
+        '    <Parameter name="Hot Path Profiling" type="bool" value="true"/>\n' +
+        '    <Parameter name="Hot Path Profile JSON File" type="string" ' +
+        'value="' + tag + '_profile.json"/>')
+    text = re.sub(r'advdiff2D_\w*out\.exo', tag + '.exo', text)
+    name = tag + ".xml"
+    open(name, 'w').write(text)
+    return name
+
+def read_solution(name):
+    values = []
+    header = True
+    for line in open(name):
+        if line.startswith('%'):
+            continue
+        if header:
+            header = False
+            continue
+        values.append(float(line))
+    return values
+
+def fill_times(name):
+    timers = json.load(open(name))["teuchos timers"]
+    return [timers[fill]["max"] if fill in timers else 0.0 for fill in fills]
+
+log_file_name = "runFusedT.log"
+if os.path.exists(log_file_name):
+    os.remove(log_file_name)
+logfile = open(log_file_name, 'w')
+
+result = 0
+test = 1
+for form in [1, 2]:
+    solutions = {}
+    times = {}
+    for path in paths:
+        tag = "advdiff2D_form%d_%s" % (form, path[0])
+        print "test %s - augmented form %d, %s" % (test, form, path[0])
+        test = test + 1
+        if os.path.exists("xfinal.mm"):
+            os.remove("xfinal.mm")
+        command = ["./AlbanyT", write_input(path[1], form, tag)]
+        p = Popen(command, stdout=logfile, stderr=logfile)
+        return_code = p.wait()
+        if return_code != 0:
+            print "result is %s" % return_code
+            print "%s has failed" % tag
+            sys.exit(return_code)
+        os.rename("xfinal.mm", tag + ".mm")
+        solutions[path[0]] = read_solution(tag + ".mm")
+        times[path[0]] = fill_times(tag + "_profile.json")
+
+    graph = solutions["graph"]
+    fused = solutions["fused"]
+    scale = max(max([abs(v) for v in graph]), 1.0)
+    diff = max([abs(g - f) for g, f in zip(graph, fused)])
+    if len(graph) != len(fused) or diff > tolerance * scale:
+        print "augmented form %d: fused and graph solutions differ by %s" \
+            % (form, diff)
+        result = 1
+
+    for i in range(len(fills)):
+        fused_time = times["fused"][i]
+        speedup = times["graph"][i] / fused_time if fused_time > 0.0 else 0.0
+        print "augmented form %d, %s: graph %.4g s, fused %.4g s, speedup %.3g" \
+            % (form, fills[i], times["graph"][i], fused_time, speedup)
+
+if result != 0:
+    print "result is %s" % result
+    print "AdvDiff fused test has failed"
+sys.exit(result)
@@ -0,0 +1,65 @@
+#! /usr/bin/env python
+
+import sys
+import os
+from subprocess import Popen
+
+# Material inputs, and the field counting the local Newton iterations of
+# the models that report them
+models = [ ["Neohookean-uniaxial", ""],
+           ["J2-uniaxial", ""],
+           ["ParallelJ2-uniaxial", ""],
+           ["Gurson-uniaxial", ""],
+           ["ParallelGurson-uniaxial", ""],
+           ["AHD-uniaxial", ""],
+           ["CP-uniaxial", "CP_Residual_Iter"] ]
+
+# Kokkos fixes the number of threads at initialization, so each thread
+# count is a separate run
+threads = [1, 2, 4]
+
+batches = "1,16,256"
+eval_types = "Residual,Jacobian"
+summary_name = "benchmark.csv"
+
+# --smoke runs only the first model on one thread
+args = [arg for arg in sys.argv[1:] if arg != "--smoke"]
+if len(args) < len(sys.argv) - 1:
+    models = models[:1]
+    threads = threads[:1]
+
+if len(args) > 0:
+    batches = args[0]
+
+if os.path.exists(summary_name):
+    os.remove(summary_name)
+
+log_file_name = "Benchmark.log"
+if os.path.exists(log_file_name):
+    os.remove(log_file_name)
+logfile = open(log_file_name, 'w')
+
+result = 0
+test = 1
+for model in models:
+    for nthreads in threads:
+        print "test %s - %s, %s threads" % (test, model[0], nthreads)
+        command = ["./MPB", "--input="+model[0]+".xml", \
+                       "--batches="+batches, \
+                       "--eval="+eval_types, \
+                       "--summary="+summary_name, \
+                       "--timing="+model[0]+"-timing.csv", \
+                       "--kokkos-threads=%s" % nthreads]
+        if model[1] != "":
+            command.append("--iterations="+model[1])
+        p = Popen(command, stdout=logfile, stderr=logfile)
+        return_code = p.wait()
+        if return_code != 0:
+            result = return_code
+            print "result is %s" % result
+            print "%s benchmark has failed" % model[0]
+            sys.exit(result)
+        test = test + 1
+
+print "summary written to %s" % summary_name
+sys.exit(result)
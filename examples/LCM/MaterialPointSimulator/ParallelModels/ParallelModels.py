@@ -0,0 +1,50 @@
+#! /usr/bin/env python
+
+import sys
+import os
+from subprocess import Popen
+
+# Run the serial model and its ParallelConstitutiveModel port through the
+# point simulator and require identical output.
+def runpair( serial_name, parallel_name ):
+    result = 0
+
+    log_file_name = parallel_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    for base_name in [serial_name, parallel_name]:
+        command = ["./MPS", "--input=\""+base_name+".xml\""]
+        p = Popen(command, stdout=logfile, stderr=logfile)
+        return_code = p.wait()
+        if return_code != 0:
+            result = return_code
+
+    command = ["./exodiff", "-stat", "-f", "exact.exodiff", \
+                   serial_name+".exo", \
+                   parallel_name+".exo"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    return result
+
+result = 0
+
+print "test 1 - J2 uniaxial"
+result = runpair("J2-uniaxial", "ParallelJ2-uniaxial")
+if result != 0:
+    print "result is %s" % result
+    print "ParallelJ2-uniaxial test has failed"
+    sys.exit(result)
+
+print "test 2 - Gurson uniaxial"
+result = runpair("Gurson-uniaxial", "ParallelGurson-uniaxial")
+if result != 0:
+    print "result is %s" % result
+    print "ParallelGurson-uniaxial test has failed"
+    sys.exit(result)
+
+sys.exit(result)
@@ -0,0 +1,38 @@
+#! /usr/bin/env python
+
+# Runs the command given on the command line (the Albany executable and its
+# input file) and checks that Sample Mesh Evaluation filled fewer worksets
+# than the mesh has, from its "filling N of M worksets" lines.
+
+import sys
+import os
+import re
+from subprocess import Popen
+
+log_file_name = "runSampleMesh.log"
+if os.path.exists(log_file_name):
+    os.remove(log_file_name)
+logfile = open(log_file_name, 'w')
+
+p = Popen(sys.argv[1:], stdout=logfile, stderr=logfile)
+result = p.wait()
+logfile.close()
+if result != 0:
+    print "result is %s" % result
+    print "sample mesh test has failed"
+    sys.exit(result)
+
+filled = 0
+total = 0
+pattern = re.compile(r"Sample Mesh Evaluation: filling (\d+) of (\d+) worksets")
+for line in open(log_file_name):
+    match = pattern.search(line)
+    if match:
+        filled = filled + int(match.group(1))
+        total = total + int(match.group(2))
+
+print "filled %s of %s worksets" % (filled, total)
+if total == 0 or filled >= total:
+    print "sample mesh test has failed: no workset was skipped"
+    sys.exit(1)
+sys.exit(0)
@@ -16,6 +16,11 @@ Please remove when issue is resolved
 */
 #undef BOOST_MATH_PROMOTE_DOUBLE_POLICY
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
 
@@ -1771,9 +1776,255 @@ ATO::SpatialFilter::buildOperator(
     }
   
     std::map< GlobalPoint, std::set<GlobalPoint> > neighbors;
+    findNeighbors(app, excludeNodes, neighbors);
+
+    if( verifyNeighborSearch ){
+      std::map< GlobalPoint, std::set<GlobalPoint> > reference;
+      findNeighborsAllPairs(app, excludeNodes, reference);
+      bool same = (neighbors.size() == reference.size());
+      std::map< GlobalPoint, std::set<GlobalPoint> >::iterator it, ref;
+      for(it=neighbors.begin(), ref=reference.begin(); same && it!=neighbors.end(); ++it, ++ref){
+        same = (it->first.gid == ref->first.gid) && (it->second.size() == ref->second.size());
+        std::set<GlobalPoint>::iterator a, b;
+        for(a=it->second.begin(), b=ref->second.begin(); same && a!=it->second.end(); ++a, ++b)
+          same = (a->gid == b->gid);
+      }
+      TEUCHOS_TEST_FOR_EXCEPTION( !same, std::logic_error, std::endl
+        << "Error!  Spatial filter neighbor search disagrees with the all-pairs search." << std::endl);
+    }
+
+    // communicate neighbor data
+    importNeighbors(neighbors,importer,exporter);
+
+    
+    // for each interior node, search boundary nodes for additional interactions off processor.
+    
+  
+    // now build filter operator, one owned row at a time
+    size_t dimension = app->getDiscretization()->getNumDim();
+    int numMyRows = localNodeMap->NumMyElements();
+    std::vector<std::map<GlobalPoint,std::set<GlobalPoint> >::const_iterator> rows(numMyRows, neighbors.end());
+    std::vector<int> rowLengths(numMyRows, 0);
+    size_t maxRowLength = 1;
+    for (int lid=0; lid<numMyRows; lid++) {
+      GlobalPoint homeNode;
+      homeNode.gid = localNodeMap->GID(lid);
+      rows[lid] = neighbors.find(homeNode);
+      if( rows[lid] == neighbors.end() ) continue;
+      rowLengths[lid] = std::max<int>(rows[lid]->second.size(), 1);
+      maxRowLength = std::max<size_t>(maxRowLength, rowLengths[lid]);
+    }
+
+    filterOperator = Teuchos::rcp(new Epetra_CrsMatrix(Copy,*localNodeMap,rowLengths.data(),/*StaticProfile=*/true));
+    std::vector<double> weights(maxRowLength);
+    std::vector<int> indices(maxRowLength);
+    for (int lid=0; lid<numMyRows; lid++) {
+      if( rows[lid] == neighbors.end() ) continue;
+      const GlobalPoint& homeNode = rows[lid]->first;
+      int home_node_gid = homeNode.gid;
+      const std::set<GlobalPoint>& connected_nodes = rows[lid]->second;
+      if( connected_nodes.size() > 0 ){
+        int entry = 0;
+        for (std::set<GlobalPoint>::const_iterator 
+             set_it=connected_nodes.begin(); set_it!=connected_nodes.end(); ++set_it, ++entry) {
+           const double* coords = &(set_it->coords[0]);
+           double distance = 0.0;
+           for (int dim=0; dim<dimension; dim++) 
+             distance += (coords[dim]-homeNode.coords[dim])*(coords[dim]-homeNode.coords[dim]);
+           distance = (distance > 0.0) ? sqrt(distance) : 0.0;
+           weights[entry] = filterRadius - distance;
+           indices[entry] = set_it->gid;
+        }
+        filterOperator->InsertGlobalValues(home_node_gid,entry,&weights[0],&indices[0]);
+      } else {
+         // if the list of connected nodes is empty, still add a one on the diagonal.
+         double weight = 1.0;
+         filterOperator->InsertGlobalValues(home_node_gid,1,&weight,&home_node_gid);
+      }
+    }
+  
+    filterOperator->FillComplete();
+
+    // scale filter operator so rows sum to one.
+    Epetra_Vector rowSums(*localNodeMap);
+    filterOperator->InvRowSums(rowSums);
+    filterOperator->LeftScale(rowSums);
+
+  return;
+
+}
+
+/******************************************************************************/
+void
+ATO::SpatialFilter::findNeighbors(
+             Teuchos::RCP<Albany::Application> app,
+             const std::set<int>& excludeNodes,
+             std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors)
+/******************************************************************************/
+{
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+          wsElNodeID = app->getDiscretization()->getWsElNodeID();
+  
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
+      coords = app->getDiscretization()->getCoords();
+
+    const Albany::WorksetArray<std::string>::type& 
+      wsEBNames = app->getDiscretization()->getWsEBNames();
+
+    const int dimension = app->getDiscretization()->getNumDim();
+
+    // the distinct local (owned and ghost) nodes, and which of them may be
+    // neighbors: nodes of the filtered blocks that aren't excluded
+    std::map<int,int> nodeIndex;
+    std::vector<GlobalPoint> points;
+    std::vector<bool> isTrial;
+    size_t num_worksets = coords.size();
+    for (size_t ws=0; ws<num_worksets; ws++) {
+      bool trialBlock = ( blocks.size() == 0 ||
+                          find(blocks.begin(), blocks.end(), wsEBNames[ws]) != blocks.end() );
+      int num_cells = coords[ws].size();
+      for (int cell=0; cell<num_cells; cell++) {
+        size_t num_nodes = coords[ws][cell].size();
+        for (int node=0; node<num_nodes; node++) {
+          int gid = wsElNodeID[ws][cell][node];
+          std::pair<std::map<int,int>::iterator,bool> ins = 
+            nodeIndex.insert(std::make_pair(gid, (int)points.size()));
+          if( ins.second ){
+            GlobalPoint newPoint;
+            newPoint.gid = gid;
+            for (int dim=0; dim<dimension; dim++)
+              newPoint.coords[dim] = coords[ws][cell][node][dim];
+            points.push_back(newPoint);
+            isTrial.push_back(false);
+          }
+          if( trialBlock && excludeNodes.find(gid) == excludeNodes.end() )
+            isTrial[ins.first->second] = true;
+        }
+      }
+    }
+
+    // bin the trial nodes in cells no smaller than the filter radius, so that
+    // all neighbors of a node lie in its cell or the adjacent ones
+    int numPoints = points.size();
+    double origin[3] = {0.0, 0.0, 0.0}, maxCorner[3] = {0.0, 0.0, 0.0};
+    bool haveTrial = false;
+    for (int i=0; i<numPoints; i++) {
+      if( !isTrial[i] ) continue;
+      for (int dim=0; dim<dimension; dim++) {
+        if( !haveTrial || points[i].coords[dim] < origin[dim] ) origin[dim] = points[i].coords[dim];
+        if( !haveTrial || points[i].coords[dim] > maxCorner[dim] ) maxCorner[dim] = points[i].coords[dim];
+      }
+      haveTrial = true;
+    }
+
+    double spacing = (filterRadius > 0.0) ? filterRadius : 1.0;
+    int nCells[3] = {1, 1, 1};
+    while( true ){
+      double count = 1.0;
+      for (int dim=0; dim<dimension; dim++)
+        count *= std::floor((maxCorner[dim]-origin[dim])/spacing) + 1;
+      if( count <= 4.0*numPoints + 64 ) break;
+      spacing *= 2.0;
+    }
+    int totalCells = 1;
+    for (int dim=0; dim<dimension; dim++) {
+      nCells[dim] = (int)std::floor((maxCorner[dim]-origin[dim])/spacing) + 1;
+      totalCells *= nCells[dim];
+    }
+
+    // cell of a coordinate, clamped to the grid
+    struct CellIndex {
+      const double* origin; double spacing; const int* nCells;
+      int operator()(double x, int dim) const {
+        int c = (int)std::floor((x-origin[dim])/spacing);
+        return std::min(std::max(c, 0), nCells[dim]-1);
+      }
+    } cellIndex = {origin, spacing, nCells};
+
+    std::vector<int> cellStart(totalCells+1, 0), cellPoints;
+    std::vector<int> pointCell(numPoints, -1);
+    for (int i=0; i<numPoints; i++) {
+      if( !isTrial[i] ) continue;
+      int c = 0;
+      for (int dim=dimension-1; dim>=0; dim--)
+        c = c*nCells[dim] + cellIndex(points[i].coords[dim], dim);
+      pointCell[i] = c;
+      cellStart[c+1]++;
+    }
+    for (int c=0; c<totalCells; c++) cellStart[c+1] += cellStart[c];
+    cellPoints.resize(cellStart[totalCells]);
+    std::vector<int> fill(cellStart.begin(), cellStart.end()-1);
+    for (int i=0; i<numPoints; i++)
+      if( pointCell[i] >= 0 ) cellPoints[fill[pointCell[i]]++] = i;
+
+    // rows are independent: search them on several threads
+    double filter_radius_sqrd = filterRadius*filterRadius;
+    std::vector<std::vector<int> > rowPoints(numPoints);
+    const int numThreads = std::max(1, std::min(searchThreads, numPoints));
+    std::vector<std::thread> threads;
+    for (int t=0; t<numThreads; t++) {
+      threads.push_back(std::thread([&, t]() {
+        for (int i=t; i<numPoints; i+=numThreads) {
+          if( !haveTrial || excludeNodes.find(points[i].gid) != excludeNodes.end() ) continue;
+          const double* home = points[i].coords;
+          int first[3] = {0, 0, 0}, last[3] = {0, 0, 0};
+          bool outside = false;
+          for (int dim=0; dim<dimension; dim++) {
+            if( home[dim]+filterRadius < origin[dim] || home[dim]-filterRadius > maxCorner[dim] ) outside = true;
+            first[dim] = cellIndex(home[dim]-filterRadius, dim);
+            last[dim] = cellIndex(home[dim]+filterRadius, dim);
+          }
+          if( outside ) continue;
+          std::vector<int>& row = rowPoints[i];
+          for (int c2=first[2]; c2<=last[2]; c2++)
+            for (int c1=first[1]; c1<=last[1]; c1++)
+              for (int c0=first[0]; c0<=last[0]; c0++) {
+                int c = (c2*nCells[1] + c1)*nCells[0] + c0;
+                for (int n=cellStart[c]; n<cellStart[c+1]; n++) {
+                  const double* trial = points[cellPoints[n]].coords;
+                  double tmp;
+                  double delta_norm_sqr = 0.;
+                  for (int dim=0; dim<dimension; dim++)  { //individual coordinates
+                    tmp = home[dim]-trial[dim];
+                    delta_norm_sqr += tmp*tmp;
+                  }
+                  if(delta_norm_sqr<=filter_radius_sqrd) row.push_back(cellPoints[n]);
+                }
+              }
+        }
+      }));
+    }
+    for (int t=0; t<numThreads; t++) threads[t].join();
+
+    // nodeIndex is ordered by gid, so each row goes in at the end of the map
+    for (std::map<int,int>::iterator it=nodeIndex.begin(); it!=nodeIndex.end(); ++it) {
+      const std::vector<int>& row = rowPoints[it->second];
+      std::set<GlobalPoint> my_neighbors;
+      for (int n=0; n<row.size(); n++) my_neighbors.insert(points[row[n]]);
+      neighbors.insert( neighbors.end(),
+        std::pair<GlobalPoint,std::set<GlobalPoint> >(points[it->second],my_neighbors) );
+    }
+}
+
+/******************************************************************************/
+void
+ATO::SpatialFilter::findNeighborsAllPairs(
+             Teuchos::RCP<Albany::Application> app,
+             const std::set<int>& excludeNodes,
+             std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors)
+/******************************************************************************/
+{
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+          wsElNodeID = app->getDiscretization()->getWsElNodeID();
   
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
+      coords = app->getDiscretization()->getCoords();
+
+    const Albany::WorksetArray<std::string>::type& 
+      wsEBNames = app->getDiscretization()->getWsEBNames();
+
     double filter_radius_sqrd = filterRadius*filterRadius;
-    // awful n^2 search... all against all
+    // n^2 search... all against all.  Kept as the reference for findNeighbors.
     size_t dimension   = app->getDiscretization()->getNumDim();
     GlobalPoint homeNode;
     size_t num_worksets = coords.size();
@@ -1820,51 +2071,8 @@ ATO::SpatialFilter::buildOperator(
         }
       }
     }
-
-    // communicate neighbor data
-    importNeighbors(neighbors,importer,exporter);
-
-    
-    // for each interior node, search boundary nodes for additional interactions off processor.
-    
-  
-    // now build filter operator
-    int numnonzeros = 0;
-    filterOperator = Teuchos::rcp(new Epetra_CrsMatrix(Copy,*localNodeMap,numnonzeros));
-    for (std::map<GlobalPoint,std::set<GlobalPoint> >::iterator 
-        it=neighbors.begin(); it!=neighbors.end(); ++it) { 
-      GlobalPoint homeNode = it->first;
-      int home_node_gid = homeNode.gid;
-      std::set<GlobalPoint> connected_nodes = it->second;
-      if( connected_nodes.size() > 0 ){
-        for (std::set<GlobalPoint>::iterator 
-             set_it=connected_nodes.begin(); set_it!=connected_nodes.end(); ++set_it) {
-           int neighbor_node_gid = set_it->gid;
-           const double* coords = &(set_it->coords[0]);
-           double distance = 0.0;
-           for (int dim=0; dim<dimension; dim++) 
-             distance += (coords[dim]-homeNode.coords[dim])*(coords[dim]-homeNode.coords[dim]);
-           distance = (distance > 0.0) ? sqrt(distance) : 0.0;
-           double weight = filterRadius - distance;
-           filterOperator->InsertGlobalValues(home_node_gid,1,&weight,&neighbor_node_gid);
-        }
-      } else {
-         // if the list of connected nodes is empty, still add a one on the diagonal.
-         double weight = 1.0;
-         filterOperator->InsertGlobalValues(home_node_gid,1,&weight,&home_node_gid);
-      }
-    }
-  
-    filterOperator->FillComplete();
-
-    // scale filter operator so rows sum to one.
-    Epetra_Vector rowSums(*localNodeMap);
-    filterOperator->InvRowSums(rowSums);
-    filterOperator->LeftScale(rowSums);
-
-  return;
-
 }
+
 /******************************************************************************/
 ATO::SpatialFilter::SpatialFilter( Teuchos::ParameterList& params )
 /******************************************************************************/
@@ -1877,7 +2085,17 @@ ATO::SpatialFilter::SpatialFilter( Teuchos::ParameterList& params )
     iterations = params.get<int>("Iterations");
   } else
     iterations = 1;
+  if( params.isType<int>("Neighbor Search Threads") ){
+    searchThreads = params.get<int>("Neighbor Search Threads");
+  } else
+    searchThreads = 1;
+  if( params.isType<bool>("Verify Neighbor Search") ){
+    verifyNeighborSearch = params.get<bool>("Verify Neighbor Search");
+  } else
+    verifyNeighborSearch = false;
 
+  TEUCHOS_TEST_FOR_EXCEPTION(searchThreads < 1, Teuchos::Exceptions::InvalidParameter, std::endl
+    << "Error!  'Neighbor Search Threads' must be at least 1." << std::endl);
 }
 
 /******************************************************************************/
@@ -57,11 +57,23 @@ namespace ATO {
              std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors,
              Teuchos::RCP<Epetra_Import>       importer,
              Teuchos::RCP<Epetra_Export>       exporter);
+      // cell-list radius search over the local nodes
+      void findNeighbors(
+             Teuchos::RCP<Albany::Application> app,
+             const std::set<int>& excludeNodes,
+             std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors);
+      // all-pairs search, the reference for findNeighbors
+      void findNeighborsAllPairs(
+             Teuchos::RCP<Albany::Application> app,
+             const std::set<int>& excludeNodes,
+             std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors);
 
       Teuchos::RCP<Epetra_CrsMatrix> filterOperator;
       int iterations;
       double filterRadius;
       Teuchos::Array<std::string> blocks;
+      int searchThreads;
+      bool verifyNeighborSearch;
   };
 
   class OptInterface {
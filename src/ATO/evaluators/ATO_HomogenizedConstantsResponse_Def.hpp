@@ -283,6 +283,7 @@ template<typename Traits>
 void ATO::HomogenizedConstantsResponseSpec<PHAL::AlbanyTraits::MPJacobian, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   RealType scale = 1.0/global_measure;
   int nterms = this->global_response.size();
   for(int i=0; i<nterms; i++)
@@ -301,5 +302,9 @@ postEvaluate(typename Traits::PostEvalData workset)
       (*overlapped_dgdxdot_mp)[block].Scale(scale);
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "HomogenizedConstantsResponseSpec<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
@@ -306,6 +306,7 @@ template<typename Traits>
 void ATO::TensorPNormResponseSpec<PHAL::AlbanyTraits::MPJacobian, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   this->global_response[0] = pow(this->global_response[0],1.0/pVal);
 
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> overlapped_dgdx_mp = workset.overlapped_mp_dgdx;
@@ -325,5 +326,9 @@ postEvaluate(typename Traits::PostEvalData workset)
       (*overlapped_dgdxdot_mp)[block].Scale(scale);
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "TensorPNormResponseSpec<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
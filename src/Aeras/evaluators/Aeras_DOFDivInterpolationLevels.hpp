@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductDerivative.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -64,6 +65,7 @@ private:
 
   Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device>    grad_at_cub_points;
   Intrepid2::FieldContainer_Kokkos<ScalarT, PHX::Layout, PHX::Device>     vcontra;
+  TensorProductDerivative tensorDeriv;
 
   const int numNodes;
   const int numDims;
@@ -73,6 +75,7 @@ private:
   std::string myName;
 
   bool originalDiv;
+  bool useSumFactorization;
 };
 
 }
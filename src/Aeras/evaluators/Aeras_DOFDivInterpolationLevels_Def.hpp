@@ -42,6 +42,7 @@ DOFDivInterpolationLevels(Teuchos::ParameterList& p,
   Teuchos::ParameterList* xsa_params =
       p.get<Teuchos::ParameterList*>("Hydrostatic Problem");
   originalDiv = xsa_params->get<bool>("Original Divergence", true);
+  useSumFactorization = xsa_params->get<bool>("Use Sum Factorization", true);
 
   std::cout << "ORIGINAL DIV ? " << originalDiv <<"\n";
 
@@ -68,6 +69,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   refPoints         .resize(numQPs, 2);
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
+  if (useSumFactorization)
+    tensorDeriv = TensorProductDerivative(grad_at_cub_points, refPoints, numNodes, numQPs);
 
   vcontra.resize(numNodes, 2);
 }
@@ -106,6 +109,13 @@ evaluateFields(typename Traits::EvalData workset)
 	  vcontra(node, 0 ) = det_j*(jinv00*val_node(cell, node, level, 0) + jinv01*val_node(cell, node, level, 1) );
 	  vcontra(node, 1 ) = det_j*(jinv10*val_node(cell, node, level, 0) + jinv11*val_node(cell, node, level, 1) );
         }//end of nodal loop
+	if (tensorDeriv.isTensorProduct()) {
+	  tensorDeriv.divergence<ScalarT>(
+	    [&](const int node) -> decltype(vcontra(node, 0)) { return vcontra(node, 0); },
+	    [&](const int node) -> decltype(vcontra(node, 1)) { return vcontra(node, 1); },
+	    [&](const int qp, const ScalarT& d) { div_val_qp(cell, qp, level) = d/jacobian_det(cell,qp); });
+	  continue;
+	}
 	for (int qp=0; qp < numQPs; ++qp) {
 	  for (int node=0; node < numNodes; ++node) {
 	    div_val_qp(cell, qp, level) += vcontra(node, 0)*grad_at_cub_points(node, qp, 0)
@@ -666,6 +666,7 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 { 
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x = workset.mp_x;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> xdot = workset.mp_xdot;
 
@@ -770,6 +771,10 @@ evaluateFields(typename Traits::EvalData workset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "GatherSolution<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -788,6 +793,7 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   const Teuchos::RCP<const Stokhos::ProductEpetraVector>    x = workset.mp_x;
   const Teuchos::RCP<const Stokhos::ProductEpetraVector> xdot = workset.mp_xdot;
 
@@ -912,6 +918,10 @@ evaluateFields(typename Traits::EvalData workset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "GatherSolution<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -617,6 +617,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f = workset.mp_f;
   //get non-const view of fT 
 //  Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
@@ -663,6 +664,10 @@ evaluateFields(typename Traits::EvalData workset)
       eq += this->numTracerVar;
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "ScatterResidual<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -681,6 +686,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector>      f = workset.mp_f;
   Teuchos::RCP<Stokhos::ProductContainer<Epetra_CrsMatrix> > Jac = workset.mp_Jac;
 
@@ -819,6 +825,10 @@ evaluateFields(typename Traits::EvalData workset)
       eq += this->numTracerVar;
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "ScatterResidual<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
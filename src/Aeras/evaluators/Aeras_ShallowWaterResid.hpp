@@ -18,6 +18,8 @@
 #include <Intrepid2_Basis.hpp>
 #include <Intrepid2_Cubature.hpp>
 
+#include "Aeras_TensorProductDerivative.hpp"
+
 
 //#define ALBANY_KOKKOS_UNDER_DEVELOPMENT
 
@@ -86,6 +88,9 @@ private:
 	Teuchos::RCP<Intrepid2::Cubature<RealType, Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout,PHX::Device> > > cubature;
 	Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device>    refPoints;
 	Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device>    refWeights;
+	//! 1D derivative matrices; gradient, divergence and curl use them when
+	//! the element is a tensor product.
+	TensorProductDerivative tensorDeriv;
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 	Intrepid2::FieldContainer_Kokkos<MeshScalarT, PHX::Layout, PHX::Device>  nodal_jacobian;
 	Intrepid2::FieldContainer_Kokkos<MeshScalarT, PHX::Layout, PHX::Device>  nodal_inv_jacobian;
@@ -197,6 +197,9 @@ ShallowWaterResid(const Teuchos::ParameterList& p,
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
+  if (shallowWaterList->get<bool>("Use Sum Factorization", true))
+    tensorDeriv = TensorProductDerivative(grad_at_cub_points, refPoints, numNodes, numQPs, nodeToQPMap);
+
   this->setName("Aeras::ShallowWaterResid"+PHX::typeAsString<EvalT>());
 
   U.fieldTag().dataLayout().dimensions(dims);
@@ -384,6 +387,20 @@ void ShallowWaterResid<EvalT,Traits>::divergence4(const PHX::MDField<ScalarT, Ce
     tempnodalvec1(cell, node, 1 ) = det_j*(jinv10*fieldAtNodes(cell, node, 0) + jinv11*fieldAtNodes(cell, node, 1) );
   }
 
+  if (tensorDeriv.isTensorProduct()) {
+    const int np = tensorDeriv.pointsPerEdge();
+    for (int j=0; j < np; ++j)
+      for (int i=0; i < np; ++i) {
+        const int qp = tensorDeriv.qp(i, j);
+        div_(cell, qp) = 0.0;
+        for (int a=0; a < np; ++a)
+          div_(cell, qp) += tensorDeriv.dx(i, a)*tempnodalvec1(cell, tensorDeriv.node(a, j), 0)
+                         +  tensorDeriv.dy(j, a)*tempnodalvec1(cell, tensorDeriv.node(i, a), 1);
+        div_(cell, qp) = div_(cell, qp)/jacobian_det(cell, qp);
+      }
+    return;
+  }
+
   for (int qp=0; qp < numQPs; ++qp) {
     div_(cell, qp) = 0.0;
     for (int node=0; node < numNodes; ++node) {
@@ -414,6 +431,23 @@ gradient4(const PHX::MDField<ScalarT, Cell, Node>  & field,
   std::cout << "ShallowWaterResid::gradient4 (kokkos)" << std::endl;
 #endif
 
+  if (tensorDeriv.isTensorProduct()) {
+    const int np = tensorDeriv.pointsPerEdge();
+    for (int j=0; j < np; ++j)
+      for (int i=0; i < np; ++i) {
+        ScalarT gx = 0;
+        ScalarT gy = 0;
+        for (int a=0; a < np; ++a) {
+          gx += tensorDeriv.dx(i, a)*field(cell, tensorDeriv.node(a, j));
+          gy += tensorDeriv.dy(j, a)*field(cell, tensorDeriv.node(i, a));
+        }
+        const int qp = tensorDeriv.qp(i, j);
+        gradient_(cell,qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
+        gradient_(cell,qp, 1) = jacobian_inv(cell, qp, 0, 1)*gx + jacobian_inv(cell, qp, 1, 1)*gy;
+      }
+    return;
+  }
+
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
@@ -452,6 +486,19 @@ void ShallowWaterResid<EvalT,Traits>::curl4(
     tempnodalvec2(cell, node, 0 ) = j00*field(cell, node, 0) + j10*field(cell, node, 1);
     tempnodalvec2(cell, node, 1 ) = j01*field(cell, node, 0) + j11*field(cell, node, 1);
   }
+  if (tensorDeriv.isTensorProduct()) {
+    const int np = tensorDeriv.pointsPerEdge();
+    for (int j=0; j < np; ++j)
+      for (int i=0; i < np; ++i) {
+        const int qp = tensorDeriv.qp(i, j);
+        curl_(cell, qp) = 0.0;
+        for (int a=0; a < np; ++a)
+          curl_(cell, qp) += tensorDeriv.dx(i, a)*tempnodalvec2(cell, tensorDeriv.node(a, j), 1)
+                          -  tensorDeriv.dy(j, a)*tempnodalvec2(cell, tensorDeriv.node(i, a), 0);
+        curl_(cell, qp) = curl_(cell, qp)/jacobian_det(cell, qp);
+      }
+    return;
+  }
   for (int qp=0; qp < numQPs; ++qp) {
     curl_(cell, qp) = 0.0;
     for (int node=0; node < numNodes; ++node) {
@@ -1650,6 +1697,14 @@ ShallowWaterResid<EvalT,Traits>::divergence(const Intrepid2::FieldContainer_Kokk
 			jinv10*fieldAtNodes(node, 0)+ jinv11*fieldAtNodes(node, 1) );
   }
 
+  if (tensorDeriv.isTensorProduct()) {
+    tensorDeriv.divergence<ScalarT>(
+      [&](const int node) -> decltype(vcontra(node, 0)) { return vcontra(node, 0); },
+      [&](const int node) -> decltype(vcontra(node, 1)) { return vcontra(node, 1); },
+      [&](const int qp, const ScalarT& d) { div(qp) = d/jacobian_det(cell,qp); });
+    return;
+  }
+
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     for (std::size_t node=0; node < numNodes; ++node) {
       div(qp) += vcontra(node, 0)*grad_at_cub_points(node, qp,0)
@@ -1682,6 +1737,16 @@ ShallowWaterResid<EvalT,Traits>::gradient(const Intrepid2::FieldContainer_Kokkos
 {
   gradField.initialize();
 
+  if (tensorDeriv.isTensorProduct()) {
+    tensorDeriv.gradient<ScalarT>(
+      [&](const int node) -> decltype(fieldAtNodes(node)) { return fieldAtNodes(node); },
+      [&](const int qp, const ScalarT& gx, const ScalarT& gy) {
+        gradField(qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
+        gradField(qp, 1) = jacobian_inv(cell, qp, 0, 1)*gx + jacobian_inv(cell, qp, 1, 1)*gy;
+      });
+    return;
+  }
+
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
@@ -1745,6 +1810,13 @@ ShallowWaterResid<EvalT,Traits>::curl(const Intrepid2::FieldContainer_Kokkos<Sca
     covariantVector(node, 1 ) = j01*nodalVector(node, 0) + j11*nodalVector(node, 1);
   }
 
+  if (tensorDeriv.isTensorProduct()) {
+    tensorDeriv.curl<ScalarT>(
+      [&](const int node) -> decltype(covariantVector(node, 0)) { return covariantVector(node, 0); },
+      [&](const int node) -> decltype(covariantVector(node, 1)) { return covariantVector(node, 1); },
+      [&](const int qp, const ScalarT& c) { curl(qp) = c/jacobian_det(cell,qp); });
+    return;
+  }
 
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     for (std::size_t node=0; node < numNodes; ++node) {
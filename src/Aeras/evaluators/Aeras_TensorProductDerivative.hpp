@@ -0,0 +1,228 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_TENSORPRODUCTDERIVATIVE_HPP
+#define AERAS_TENSORPRODUCTDERIVATIVE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+
+namespace Aeras {
+
+/* Sum-factorized reference derivatives on tensor-product spectral quads.
+ *
+ * On a quad whose np x np nodes sit on the quadrature points, the reference
+ * gradient of node (a,b) at point (i,j) is (D_x(i,a) delta(j,b),
+ * delta(i,a) D_y(j,b)). Applying the 1D matrices D_x and D_y along each
+ * direction costs O(np^3) per element instead of the O(np^4) contraction
+ * with the full (node, qp, dim) table.
+ *
+ * The constructor reads D_x, D_y and the node and point orderings off the
+ * gradient table and checks the whole table against them. If the element is
+ * not of this form, isTensorProduct() is false and the callers keep the full
+ * contraction.
+ *
+ * The host kernels take nodal values as functors f(node) and hand results to
+ * store(qp, ...), so they work on any array layout. Device kernels loop over
+ * the KOKKOS_INLINE_FUNCTION accessors dx, dy, qp and node directly; the
+ * tables live in Kokkos::Views so the object can be captured by a functor.
+ */
+class TensorProductDerivative {
+public:
+
+  TensorProductDerivative () : np_(0) {}
+
+  //! grad(node, qp, dim) and points(qp, dim) as from Intrepid2; node v sits
+  //! on point v.
+  template<typename GradArray, typename PointArray>
+  TensorProductDerivative (const GradArray& grad, const PointArray& points,
+                           const int numNodes, const int numQPs)
+    : np_(0)
+  {
+    build(grad, points, numNodes, numQPs, std::vector<int>());
+  }
+
+  //! As above, with node v on point nodeToQPMap[v].
+  template<typename GradArray, typename PointArray, typename IndexVector>
+  TensorProductDerivative (const GradArray& grad, const PointArray& points,
+                           const int numNodes, const int numQPs,
+                           const IndexVector& nodeToQPMap)
+    : np_(0)
+  {
+    build(grad, points, numNodes, numQPs,
+          std::vector<int>(nodeToQPMap.begin(), nodeToQPMap.end()));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool isTensorProduct () const { return np_ > 0; }
+
+  KOKKOS_INLINE_FUNCTION
+  int pointsPerEdge () const { return np_; }
+
+  //! Derivative of the 1D basis function a at point i along xi.
+  KOKKOS_INLINE_FUNCTION
+  double dx (const int i, const int a) const { return Dx_(i, a); }
+
+  //! Derivative of the 1D basis function a at point j along eta.
+  KOKKOS_INLINE_FUNCTION
+  double dy (const int j, const int a) const { return Dy_(j, a); }
+
+  //! Quadrature point at position (i,j).
+  KOKKOS_INLINE_FUNCTION
+  int qp (const int i, const int j) const { return qp_(j*np_ + i); }
+
+  //! Node at position (a,b).
+  KOKKOS_INLINE_FUNCTION
+  int node (const int a, const int b) const { return node_(b*np_ + a); }
+
+  //! store(qp, d/dxi f, d/deta f) for every quadrature point.
+  template<typename ScalarT, typename NodalFn, typename StoreFn>
+  void gradient (const NodalFn& f, const StoreFn& store) const {
+    for (int j = 0; j < np_; ++j)
+      for (int i = 0; i < np_; ++i) {
+        ScalarT gx = 0, gy = 0;
+        for (int a = 0; a < np_; ++a) {
+          gx += hDx_(i, a)*f(hNode_(j*np_ + a));
+          gy += hDy_(j, a)*f(hNode_(a*np_ + i));
+        }
+        store(hQP_(j*np_ + i), gx, gy);
+      }
+  }
+
+  //! store(qp, d/dxi f0 + d/deta f1) for every quadrature point.
+  template<typename ScalarT, typename NodalFn0, typename NodalFn1, typename StoreFn>
+  void divergence (const NodalFn0& f0, const NodalFn1& f1, const StoreFn& store) const {
+    for (int j = 0; j < np_; ++j)
+      for (int i = 0; i < np_; ++i) {
+        ScalarT div = 0;
+        for (int a = 0; a < np_; ++a)
+          div += hDx_(i, a)*f0(hNode_(j*np_ + a))
+               + hDy_(j, a)*f1(hNode_(a*np_ + i));
+        store(hQP_(j*np_ + i), div);
+      }
+  }
+
+  //! store(qp, d/dxi f1 - d/deta f0) for every quadrature point.
+  template<typename ScalarT, typename NodalFn0, typename NodalFn1, typename StoreFn>
+  void curl (const NodalFn0& f0, const NodalFn1& f1, const StoreFn& store) const {
+    for (int j = 0; j < np_; ++j)
+      for (int i = 0; i < np_; ++i) {
+        ScalarT curl = 0;
+        for (int a = 0; a < np_; ++a)
+          curl += hDx_(i, a)*f1(hNode_(j*np_ + a))
+                - hDy_(j, a)*f0(hNode_(a*np_ + i));
+        store(hQP_(j*np_ + i), curl);
+      }
+  }
+
+private:
+
+  template<typename GradArray, typename PointArray>
+  void build (const GradArray& grad, const PointArray& points,
+              const int numNodes, const int numQPs,
+              const std::vector<int>& nodeToQPMap) {
+    const int np = static_cast<int>(std::sqrt(static_cast<double>(numQPs)) + 0.5);
+    if (np < 2 || np*np != numQPs || numNodes != numQPs) return;
+    if ( ! nodeToQPMap.empty() && static_cast<int>(nodeToQPMap.size()) != numNodes) return;
+
+    // Index (i,j) of each point along the two reference directions.
+    std::vector<int> pointIndex(2*numQPs);
+    for (int d = 0; d < 2; ++d) {
+      std::vector<double> x(numQPs);
+      for (int q = 0; q < numQPs; ++q) x[q] = points(q, d);
+      std::vector<double> x1d(x);
+      std::sort(x1d.begin(), x1d.end());
+      x1d.erase(std::unique(x1d.begin(), x1d.end(), closeTo), x1d.end());
+      if (static_cast<int>(x1d.size()) != np) return;
+      for (int q = 0; q < numQPs; ++q) {
+        int k = 0;
+        for (int m = 1; m < np; ++m)
+          if (std::abs(x[q] - x1d[m]) < std::abs(x[q] - x1d[k])) k = m;
+        pointIndex[2*q + d] = k;
+      }
+    }
+
+    std::vector<int> qp(numQPs, -1), node(numQPs, -1);
+    for (int q = 0; q < numQPs; ++q) {
+      int& slot = qp[pointIndex[2*q + 1]*np + pointIndex[2*q]];
+      if (slot >= 0) return;
+      slot = q;
+    }
+    for (int v = 0; v < numNodes; ++v) {
+      const int q = nodeToQPMap.empty() ? v : nodeToQPMap[v];
+      if (q < 0 || q >= numQPs) return;
+      int& slot = node[pointIndex[2*q + 1]*np + pointIndex[2*q]];
+      if (slot >= 0) return;
+      slot = v;
+    }
+
+    // 1D matrices from the first row and column of nodes.
+    std::vector<double> Dx(np*np), Dy(np*np);
+    double scale = 1.0;
+    for (int i = 0; i < np; ++i)
+      for (int a = 0; a < np; ++a) {
+        Dx[i*np + a] = grad(node[a], qp[i], 0);
+        Dy[i*np + a] = grad(node[a*np], qp[i*np], 1);
+        scale = std::max(scale, std::max(std::abs(Dx[i*np + a]), std::abs(Dy[i*np + a])));
+      }
+
+    // The full table must be the tensor product of the 1D matrices.
+    const double tol = 1.0e-10*scale;
+    for (int b = 0; b < np; ++b)
+      for (int a = 0; a < np; ++a)
+        for (int j = 0; j < np; ++j)
+          for (int i = 0; i < np; ++i) {
+            const int v = node[b*np + a], q = qp[j*np + i];
+            const double gx = (j == b) ? Dx[i*np + a] : 0.0;
+            const double gy = (i == a) ? Dy[j*np + b] : 0.0;
+            if (std::abs(grad(v, q, 0) - gx) > tol ||
+                std::abs(grad(v, q, 1) - gy) > tol) return;
+          }
+
+    np_ = np;
+    Dx_ = Kokkos::View<double**, PHX::Device>("TensorProductDerivative::Dx", np, np);
+    Dy_ = Kokkos::View<double**, PHX::Device>("TensorProductDerivative::Dy", np, np);
+    qp_ = Kokkos::View<int*, PHX::Device>("TensorProductDerivative::qp", numQPs);
+    node_ = Kokkos::View<int*, PHX::Device>("TensorProductDerivative::node", numQPs);
+    hDx_ = Kokkos::create_mirror_view(Dx_);
+    hDy_ = Kokkos::create_mirror_view(Dy_);
+    hQP_ = Kokkos::create_mirror_view(qp_);
+    hNode_ = Kokkos::create_mirror_view(node_);
+    for (int i = 0; i < np; ++i)
+      for (int a = 0; a < np; ++a) {
+        hDx_(i, a) = Dx[i*np + a];
+        hDy_(i, a) = Dy[i*np + a];
+      }
+    for (int k = 0; k < numQPs; ++k) {
+      hQP_(k) = qp[k];
+      hNode_(k) = node[k];
+    }
+    Kokkos::deep_copy(Dx_, hDx_);
+    Kokkos::deep_copy(Dy_, hDy_);
+    Kokkos::deep_copy(qp_, hQP_);
+    Kokkos::deep_copy(node_, hNode_);
+  }
+
+  static bool closeTo (const double x, const double y) {
+    return std::abs(x - y) < 1.0e-12*std::max(1.0, std::max(std::abs(x), std::abs(y)));
+  }
+
+  int np_;
+  //! D(i,a): derivative of the 1D basis function a at point i.
+  Kokkos::View<double**, PHX::Device> Dx_, Dy_;
+  //! Quadrature point and node at position (i,j), stored at j*np + i.
+  Kokkos::View<int*, PHX::Device> qp_, node_;
+  //! Host copies for the functor kernels.
+  Kokkos::View<double**, PHX::Device>::HostMirror hDx_, hDy_;
+  Kokkos::View<int*, PHX::Device>::HostMirror hQP_, hNode_;
+};
+
+} // namespace Aeras
+
+#endif
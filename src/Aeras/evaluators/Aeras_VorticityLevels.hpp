@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductDerivative.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -62,6 +63,8 @@ private:
 
   Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device>    grad_at_cub_points;
   Intrepid2::FieldContainer_Kokkos<ScalarT, PHX::Layout, PHX::Device>     vco;
+  TensorProductDerivative tensorDeriv;
+  bool useSumFactorization;
 
   const int numNodes;
   const int numDims;
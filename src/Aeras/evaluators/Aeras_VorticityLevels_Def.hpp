@@ -39,6 +39,10 @@ VorticityLevels(Teuchos::ParameterList& p,
 
   this->setName("Aeras::VorticityLevels"+PHX::typeAsString<EvalT>());
 
+  Teuchos::ParameterList* hs_params =
+      p.get<Teuchos::ParameterList*>("Hydrostatic Problem");
+  useSumFactorization = hs_params->get<bool>("Use Sum Factorization", true);
+
   //std::cout << "In Vorticity, name = " << this->getName() << "\n";
   //std::cout<< "Aeras::VorticityLevels: " << numNodes << " " << numDims << " " << numQPs << " " << numLevels << std::endl;
 }
@@ -60,6 +64,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   refPoints         .resize(numQPs, 2);
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
+  if (useSumFactorization)
+    tensorDeriv = TensorProductDerivative(grad_at_cub_points, refPoints, numNodes, numQPs);
 
   vco.resize(numNodes, 2);
 }
@@ -145,6 +151,14 @@ evaluateFields(typename Traits::EvalData workset)
 	vco(node, 1 ) = j01*val_node(cell, node, level, 0) + j11*val_node(cell, node, level, 1);
       }
 
+      if (tensorDeriv.isTensorProduct()) {
+        tensorDeriv.curl<ScalarT>(
+          [&](const int node) -> decltype(vco(node, 0)) { return vco(node, 0); },
+          [&](const int node) -> decltype(vco(node, 1)) { return vco(node, 1); },
+          [&](const int qp, const ScalarT& c) { vort_val_qp(cell,qp,level) = c/jacobian_det(cell,qp); });
+        continue;
+      }
+
       for (std::size_t qp=0; qp < numQPs; ++qp) {
         for (std::size_t node=0; node < numNodes; ++node) {
 	  vort_val_qp(cell,qp,level) += vco(node, 1)*grad_at_cub_points(node, qp,0)
@@ -433,6 +433,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
 
   {//Vorticity at QP
     RCP<ParameterList> p = rcp(new ParameterList("Vorticity"));
+    Teuchos::ParameterList& paramList = params->sublist("Hydrostatic Problem");
+    p->set<Teuchos::ParameterList*>("Hydrostatic Problem", &paramList);
     // Input
     p->set<string>("Velx",                   dof_names_levels[0]);
     p->set<string>("Gradient BF Name",       "Grad BF");
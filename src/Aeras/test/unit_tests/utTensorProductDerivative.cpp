@@ -0,0 +1,229 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Checks the sum-factorized derivatives of Aeras::TensorProductDerivative
+// against the full contraction with the Intrepid2 gradient table on
+// spectral quads, on the host and through a Kokkos kernel, and reports the
+// speedup of the sum-factorized gradient.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_Time.hpp"
+#include "Kokkos_Core.hpp"
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Intrepid2_FieldContainer_Kokkos.hpp"
+#include "Intrepid2_HGRAD_QUAD_Cn_FEM.hpp"
+#include "Intrepid2_CubaturePolylib.hpp"
+#include "Intrepid2_CubatureTensor.hpp"
+
+#include "Aeras_TensorProductDerivative.hpp"
+
+bool TpetraBuild = false;
+
+namespace {
+
+typedef Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device> FC;
+
+//! Gradient table and node-to-point map of the spectral quad of degree np-1,
+//! on the tensor Gauss-Lobatto rule the Aeras problems use.
+struct SpectralQuad {
+  int np, numNodes, numQPs;
+  FC points, weights, grad;
+  std::vector<int> nodeToQP;
+
+  explicit SpectralQuad (const int np_) : np(np_), numNodes(np_*np_), numQPs(np_*np_) {
+    const int deg = np - 1;
+    Intrepid2::Basis_HGRAD_QUAD_Cn_FEM<double, FC> basis(deg, Intrepid2::POINTTYPE_SPECTRAL);
+    Teuchos::RCP<Intrepid2::Cubature<double, FC> > polylib = Teuchos::rcp(
+      new Intrepid2::CubaturePolylib<double, FC>(2*deg - 1, Intrepid2::PL_GAUSS_LOBATTO));
+    std::vector<Teuchos::RCP<Intrepid2::Cubature<double, FC> > > cubatures(2, polylib);
+    Intrepid2::CubatureTensor<double, FC> cubature(cubatures);
+
+    points.resize(numQPs, 2);
+    weights.resize(numQPs);
+    cubature.getCubature(points, weights);
+    grad.resize(numNodes, numQPs, 2);
+    basis.getValues(grad, points, Intrepid2::OPERATOR_GRAD);
+
+    // Node v sits on the point where its basis function is one.
+    FC values(numNodes, numQPs);
+    basis.getValues(values, points, Intrepid2::OPERATOR_VALUE);
+    nodeToQP.assign(numNodes, -1);
+    for (int v = 0; v < numNodes; ++v)
+      for (int q = 0; q < numQPs; ++q)
+        if (std::abs(values(v, q) - 1.0) < 1.0e-10) nodeToQP[v] = q;
+  }
+};
+
+double nodalValue (const int cell, const int node) {
+  return std::sin(0.37*node + 1.3*cell) + 0.1*node;
+}
+
+//! Sum-factorized reference gradient of one cell per work item, through the
+//! device accessors.
+struct GradientKernel {
+  Aeras::TensorProductDerivative td;
+  Kokkos::View<double**, PHX::Device> f;
+  Kokkos::View<double***, PHX::Device> g;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int cell) const {
+    const int np = td.pointsPerEdge();
+    for (int j = 0; j < np; ++j)
+      for (int i = 0; i < np; ++i) {
+        double gx = 0, gy = 0;
+        for (int a = 0; a < np; ++a) {
+          gx += td.dx(i, a)*f(cell, td.node(a, j));
+          gy += td.dy(j, a)*f(cell, td.node(i, a));
+        }
+        g(cell, td.qp(i, j), 0) = gx;
+        g(cell, td.qp(i, j), 1) = gy;
+      }
+  }
+};
+
+TEUCHOS_UNIT_TEST(TensorProductDerivative, MatchesFullContraction)
+{
+  for (int np = 2; np <= 8; ++np) {
+    const SpectralQuad quad(np);
+    const Aeras::TensorProductDerivative td(
+      quad.grad, quad.points, quad.numNodes, quad.numQPs, quad.nodeToQP);
+    TEST_ASSERT(td.isTensorProduct());
+    TEST_EQUALITY(td.pointsPerEdge(), np);
+    if ( ! td.isTensorProduct()) continue;
+
+    const int cell = 3;
+    const double tol = 1.0e-10*np*np;
+    std::vector<double> gx(quad.numQPs), gy(quad.numQPs), div(quad.numQPs), curl(quad.numQPs);
+    td.gradient<double>(
+      [&](const int v) { return nodalValue(cell, v); },
+      [&](const int q, const double x, const double y) { gx[q] = x; gy[q] = y; });
+    td.divergence<double>(
+      [&](const int v) { return nodalValue(cell, v); },
+      [&](const int v) { return nodalValue(cell + 1, v); },
+      [&](const int q, const double d) { div[q] = d; });
+    td.curl<double>(
+      [&](const int v) { return nodalValue(cell, v); },
+      [&](const int v) { return nodalValue(cell + 1, v); },
+      [&](const int q, const double c) { curl[q] = c; });
+
+    for (int q = 0; q < quad.numQPs; ++q) {
+      double fx = 0, fy = 0, hx = 0, hy = 0;
+      for (int v = 0; v < quad.numNodes; ++v) {
+        fx += nodalValue(cell, v)*quad.grad(v, q, 0);
+        fy += nodalValue(cell, v)*quad.grad(v, q, 1);
+        hx += nodalValue(cell + 1, v)*quad.grad(v, q, 0);
+        hy += nodalValue(cell + 1, v)*quad.grad(v, q, 1);
+      }
+      TEST_COMPARE(std::abs(gx[q] - fx), <=, tol);
+      TEST_COMPARE(std::abs(gy[q] - fy), <=, tol);
+      TEST_COMPARE(std::abs(div[q] - (fx + hy)), <=, tol);
+      TEST_COMPARE(std::abs(curl[q] - (hx - fy)), <=, tol);
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(TensorProductDerivative, DeviceKernel)
+{
+  const int np = 4, numCells = 64;
+  const SpectralQuad quad(np);
+  GradientKernel kernel;
+  kernel.td = Aeras::TensorProductDerivative(
+    quad.grad, quad.points, quad.numNodes, quad.numQPs, quad.nodeToQP);
+  TEST_ASSERT(kernel.td.isTensorProduct());
+
+  kernel.f = Kokkos::View<double**, PHX::Device>("f", numCells, quad.numNodes);
+  kernel.g = Kokkos::View<double***, PHX::Device>("g", numCells, quad.numQPs, 2);
+  Kokkos::View<double**, PHX::Device>::HostMirror f = Kokkos::create_mirror_view(kernel.f);
+  for (int cell = 0; cell < numCells; ++cell)
+    for (int v = 0; v < quad.numNodes; ++v) f(cell, v) = nodalValue(cell, v);
+  Kokkos::deep_copy(kernel.f, f);
+
+  Kokkos::parallel_for(numCells, kernel);
+  Kokkos::fence();
+
+  Kokkos::View<double***, PHX::Device>::HostMirror g = Kokkos::create_mirror_view(kernel.g);
+  Kokkos::deep_copy(g, kernel.g);
+  for (int cell = 0; cell < numCells; ++cell)
+    for (int q = 0; q < quad.numQPs; ++q)
+      for (int d = 0; d < 2; ++d) {
+        double full = 0;
+        for (int v = 0; v < quad.numNodes; ++v)
+          full += f(cell, v)*quad.grad(v, q, d);
+        TEST_COMPARE(std::abs(g(cell, q, d) - full), <=, 1.0e-10*quad.numNodes);
+      }
+}
+
+TEUCHOS_UNIT_TEST(TensorProductDerivative, Speedup)
+{
+  // Timing only: the speedup is reported, not checked, so loaded test
+  // machines do not fail this.
+  const int numCells = 2000;
+  for (int np = 4; np <= 8; np += 2) {
+    const SpectralQuad quad(np);
+    const Aeras::TensorProductDerivative td(
+      quad.grad, quad.points, quad.numNodes, quad.numQPs, quad.nodeToQP);
+    TEST_ASSERT(td.isTensorProduct());
+
+    std::vector<double> f(numCells*quad.numNodes);
+    for (int cell = 0; cell < numCells; ++cell)
+      for (int v = 0; v < quad.numNodes; ++v)
+        f[cell*quad.numNodes + v] = nodalValue(cell, v);
+    std::vector<double> table(quad.numNodes*quad.numQPs*2);
+    for (int v = 0; v < quad.numNodes; ++v)
+      for (int q = 0; q < quad.numQPs; ++q)
+        for (int d = 0; d < 2; ++d)
+          table[(v*quad.numQPs + q)*2 + d] = quad.grad(v, q, d);
+
+    double sumFull = 0, sumFactored = 0;
+    Teuchos::Time full("full"), factored("factored");
+    full.start();
+    for (int cell = 0; cell < numCells; ++cell) {
+      const double* fc = &f[cell*quad.numNodes];
+      for (int q = 0; q < quad.numQPs; ++q) {
+        double gx = 0, gy = 0;
+        for (int v = 0; v < quad.numNodes; ++v) {
+          gx += fc[v]*table[(v*quad.numQPs + q)*2];
+          gy += fc[v]*table[(v*quad.numQPs + q)*2 + 1];
+        }
+        sumFull += gx + gy;
+      }
+    }
+    full.stop();
+    factored.start();
+    for (int cell = 0; cell < numCells; ++cell) {
+      const double* fc = &f[cell*quad.numNodes];
+      td.gradient<double>(
+        [&](const int v) { return fc[v]; },
+        [&](const int q, const double x, const double y) { sumFactored += x + y; });
+    }
+    factored.stop();
+
+    TEST_FLOATING_EQUALITY(sumFactored, sumFull, 1.0e-8);
+    out << np << " points per edge: full " << full.totalElapsedTime()
+        << " s, sum-factorized " << factored.totalElapsedTime() << " s, speedup "
+        << full.totalElapsedTime()/std::max(factored.totalElapsedTime(), 1.0e-12)
+        << std::endl;
+  }
+}
+
+} // namespace
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+  const int status = Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+  Kokkos::finalize();
+  return status;
+}
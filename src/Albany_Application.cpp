@@ -25,6 +25,9 @@
 #endif
 
 #include<string>
+#include <algorithm>
+#include <limits>
+#include <chrono>
 #include "Albany_DataTypes.hpp"
 
 #include "Albany_DummyParameterAccessor.hpp"
@@ -41,7 +44,15 @@
 #endif
 
 #include "Albany_ScalarResponseFunction.hpp"
+#include "Albany_FieldManagerScalarResponseFunction.hpp"
+#include "Albany_WorksetColoring.hpp"
+#include "Albany_JacobianAssemblyPlan.hpp"
 #include "PHAL_Utilities.hpp"
+#include "utility/ProfileGuard.hpp"
+#include "Albany_ProblemUtils.hpp"
+#include "Intrepid2_DefaultCubatureFactory.hpp"
+
+#include <unistd.h>
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -76,7 +87,17 @@ Application(const RCP<const Teuchos_Comm>& comm_,
   morphFromInit(true), perturbBetaForDirichlets(0.0),
   phxGraphVisDetail(0),
   stateGraphVisDetail(0),
-  params_(params)
+  params_(params),
+  autoWorksetSize(false),
+  worksetCacheSize(0),
+  numFillThreads(1),
+  checkParallelFill(false),
+  measureFillCost(false),
+  wsColorsMeshGeneration(-1),
+  fusedResponses(false),
+  fusedTime(0.0),
+  sampleWorksetsMeshGeneration(-1),
+  nodeDiagGraphMeshGeneration(-1)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
@@ -97,7 +118,17 @@ Application(const RCP<const Teuchos_Comm>& comm_) :
     shapeParamsHaveBeenReset(false),
     morphFromInit(true), perturbBetaForDirichlets(0.0),
     phxGraphVisDetail(0),
-    stateGraphVisDetail(0)
+    stateGraphVisDetail(0),
+    autoWorksetSize(false),
+    worksetCacheSize(0),
+    numFillThreads(1),
+    checkParallelFill(false),
+    measureFillCost(false),
+    wsColorsMeshGeneration(-1),
+    fusedResponses(false),
+    fusedTime(0.0),
+    sampleWorksetsMeshGeneration(-1),
+    nodeDiagGraphMeshGeneration(-1)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
@@ -259,6 +290,9 @@ void Albany::Application::initialSetUp(const RCP<Teuchos::ParameterList>& params
     //Search for "Explicit" in the stepperType name.  If it's found, set expl to true.
     if (stepperType.find("Explicit") != std::string::npos)
       expl = true;
+    //Central difference uses a lumped mass and never forms a Jacobian
+    if (problemParams->get("Second Order", "No") == "Central Difference")
+      expl = true;
   }
   //*out << "stepperType, expl: " <<stepperType << ", " <<  expl << std::endl;
 
@@ -283,6 +317,31 @@ void Albany::Application::initialSetUp(const RCP<Teuchos::ParameterList>& params
   determinePiroSolver(params);
 
   physicsBasedPreconditioner = problemParams->get("Use Physics-Based Preconditioner",false);
+
+  measureFillCost = problemParams->get("Measure Fill Cost", false);
+
+  fusedResponses = problemParams->get("Fused Responses", false);
+
+  if (problemParams->get("Parallel Workset Fill", false)) {
+    numFillThreads = problemParams->get("Parallel Workset Fill Threads", 1);
+    TEUCHOS_TEST_FOR_EXCEPTION(numFillThreads < 1, Teuchos::Exceptions::InvalidParameter,
+                               std::endl << "Error in Albany::Application: " <<
+                               "Parallel Workset Fill Threads must be >= 1, not " <<
+                               numFillThreads << std::endl);
+  }
+  {
+    // Not read with defaults: the mesh structs validate this list
+    const Teuchos::ParameterList& discList = params->sublist("Discretization");
+    autoWorksetSize = discList.isParameter("Auto Workset Size") ?
+      discList.get<bool>("Auto Workset Size") : false;
+    worksetCacheSize = discList.isParameter("Workset Cache Size") ?
+      discList.get<int>("Workset Cache Size") : 0;
+    TEUCHOS_TEST_FOR_EXCEPTION(worksetCacheSize < 0, Teuchos::Exceptions::InvalidParameter,
+                               std::endl << "Error in Albany::Application: " <<
+                               "Workset Cache Size must be >= 0, not " <<
+                               worksetCacheSize << std::endl);
+  }
+
 #ifdef ALBANY_TEKO
   if (physicsBasedPreconditioner)
     tekoParams = Teuchos::sublist(problemParams, "Teko", true);
@@ -344,6 +403,7 @@ void Albany::Application::initialSetUp(const RCP<Teuchos::ParameterList>& params
   writeToCoutJac = debugParams->get("Write Jacobian to Standard Output", 0);
   writeToCoutRes = debugParams->get("Write Residual to Standard Output", 0);
   derivatives_check_ = debugParams->get<int>("Derivative Check", 0);
+  checkParallelFill = debugParams->get<bool>("Parallel Workset Fill Check", false);
   //the above 4 parameters cannot have values < -1
   if (writeToMatrixMarketJac < -1)  {TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
                                   std::endl << "Error in Albany::Application constructor:  " <<
@@ -417,6 +477,71 @@ void Albany::Application::initialSetUp(const RCP<Teuchos::ParameterList>& params
 void Albany::Application::createMeshSpecs() {
   // Get mesh specification object: worksetSize, cell topology, etc
   meshSpecs = discFactory->createMeshSpecs();
+
+  if (autoWorksetSize) tuneWorksetSize();
+}
+
+void Albany::Application::tuneWorksetSize() {
+  std::size_t cacheBytes = worksetCacheSize;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+  if (cacheBytes == 0) {
+    const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0) cacheBytes = l2;
+  }
+#endif
+  if (cacheBytes == 0) cacheBytes = 1 << 20;
+
+  const int neq = std::max<int>(problem->numEquations(), 1);
+  const int numDim = problem->spatialDimension();
+
+  // Entries per cell of the fields a typical evaluator chain allocates, from
+  // the same layouts the problems build: mesh fields hold doubles, solution
+  // fields hold Jacobian FADs of neq*numNodes derivatives.
+  std::size_t maxCellBytes = 0;
+  for (int ps = 0; ps < meshSpecs.size(); ++ps) {
+    const CellTopologyData& ctd = meshSpecs[ps]->ctd;
+    const int numNodes = Albany::getIntrepid2Basis(ctd)->getCardinality();
+    Intrepid2::DefaultCubatureFactory<RealType, Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device> > cubFactory;
+    const shards::CellTopology cellType(&ctd);
+    const int numQPs = cubFactory.create(cellType, meshSpecs[ps]->cubatureDegree)->getNumPoints();
+
+    // Coordinates at nodes and QPs; BF, wBF, Grad BF, wGrad BF; Jacobian,
+    // its inverse and determinant, weighted measure
+    const std::size_t meshEntries =
+      (numNodes + numQPs)*numDim + 2*numNodes*numQPs*(1 + numDim) +
+      numQPs*(2*numDim*numDim + 2);
+    // Gathered solution, time derivative and residual at nodes; value, time
+    // derivative, gradient and a flux per equation at QPs
+    const std::size_t scalarEntries =
+      3*neq*numNodes + neq*numQPs*(2 + 2*numDim);
+    const std::size_t fadBytes = sizeof(RealType)*(neq*numNodes + 1);
+
+    maxCellBytes = std::max(maxCellBytes,
+                            sizeof(RealType)*meshEntries + fadBytes*scalarEntries);
+  }
+  if (maxCellBytes == 0) return;
+
+  const int fitSize = std::max<int>(cacheBytes/maxCellBytes, 1);
+
+  // "Workset Size" stays the upper bound; split the current worksets evenly
+  // so that the last one of a block is not mostly padding. The STK and PUMI
+  // meshes fill every block's buckets up to meshSpecs[0]->worksetSize (passed
+  // to setFieldAndBulkData), so all blocks get the same size.
+  int worksetSize = meshSpecs[0]->worksetSize;
+  for (int ps = 1; ps < meshSpecs.size(); ++ps)
+    worksetSize = std::min(worksetSize, meshSpecs[ps]->worksetSize);
+  if (fitSize < worksetSize) {
+    const int numWorksets = 1 + (worksetSize - 1)/fitSize;
+    worksetSize = 1 + (worksetSize - 1)/numWorksets;
+  }
+
+  *out << "Auto Workset Size: about " << maxCellBytes << " bytes of field data per cell"
+       << " in a " << cacheBytes << " byte cache" << std::endl;
+  for (int ps = 0; ps < meshSpecs.size(); ++ps) {
+    meshSpecs[ps]->worksetSize = worksetSize;
+    *out << "  element block " << meshSpecs[ps]->ebName
+         << ": workset size " << worksetSize << std::endl;
+  }
 }
 
 void Albany::Application::createMeshSpecs(Teuchos::RCP<Albany::AbstractMeshStruct> mesh) {
@@ -434,6 +559,8 @@ void Albany::Application::buildProblem()   {
 
   problem->buildProblem(meshSpecs, stateMgr);
 
+  if (numFillThreads > 1) setupParallelWorksetFill();
+
   neq = problem->numEquations();
   spatial_dimension = problem->spatialDimension();
 
@@ -453,6 +580,8 @@ void Albany::Application::buildProblem()   {
   const Teuchos::Array<unsigned int> defaultDataUnsignedInt;
   relative_responses = responseList.get("Relative Responses Markers", defaultDataUnsignedInt);
 
+  if (fusedResponses) setupFusedResponses();
+
 
   // Build state field manager
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->beginBuildingSfm();
@@ -735,6 +864,59 @@ getJacobianGraphT() const
   return disc->getJacobianGraphT();
 }
 
+RCP<const Tpetra_CrsGraph>
+Albany::Application::
+getNodeJacobianGraphT() const
+{
+  return disc->getNodeJacobianGraphT();
+}
+
+namespace {
+RCP<const Tpetra_CrsGraph> diagonalGraph(const RCP<const Tpetra_Map>& mapT)
+{
+  const RCP<Tpetra_CrsGraph> graphT =
+    rcp(new Tpetra_CrsGraph(mapT, 1, Tpetra::StaticProfile));
+  for (LO i=0; i < mapT->getNodeNumElements(); i++) {
+    const GO gid = mapT->getGlobalElement(i);
+    graphT->insertGlobalIndices(gid, Teuchos::arrayView(&gid, 1));
+  }
+  graphT->fillComplete();
+  return graphT;
+}
+} // namespace
+
+RCP<const Tpetra_CrsGraph>
+Albany::Application::
+getNodeBlockDiagonalGraphT()
+{
+  if (Teuchos::nonnull(nodeDiagGraphT) &&
+      nodeDiagGraphMeshGeneration == disc->getMeshGeneration())
+    return nodeDiagGraphT;
+
+  // Node blocks are addressed as DOF LID / neq, as for Block CRS storage
+  const RCP<const Tpetra_Map> overlapNodeMapT = disc->getOverlapNodeMapT();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    overlapNodeMapT->getNodeNumElements()*neq != disc->getOverlapMapT()->getNodeNumElements(),
+    std::logic_error, "Block diagonal Jacobian requires " << neq
+    << " DOFs on every node." << std::endl);
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type&
+        wsElNodeEqID = disc->getWsElNodeEqID();
+  for (int ws=0; ws < wsElNodeEqID.size(); ws++)
+    for (int cell=0; cell < wsElNodeEqID[ws].size(); cell++)
+      for (int node=0; node < wsElNodeEqID[ws][cell].size(); node++)
+        for (int eq=0; eq < neq; eq++)
+          TEUCHOS_TEST_FOR_EXCEPTION(
+            wsElNodeEqID[ws][cell][node][eq] != wsElNodeEqID[ws][cell][node][0] + eq ||
+            wsElNodeEqID[ws][cell][node][0] % neq != 0,
+            std::logic_error, "Block diagonal Jacobian requires Interleaved Ordering." << std::endl);
+
+  nodeDiagGraphT = diagonalGraph(disc->getNodeMapT());
+  overlapNodeDiagGraphT = diagonalGraph(overlapNodeMapT);
+  overlapped_jacBlockDiagT = rcp(new Tpetra_BlockCrsMatrix(*overlapNodeDiagGraphT, neq));
+  nodeDiagGraphMeshGeneration = disc->getMeshGeneration();
+  return nodeDiagGraphT;
+}
+
 #if defined(ALBANY_EPETRA)
 RCP<Epetra_Operator>
 Albany::Application::
@@ -957,7 +1139,7 @@ void checkDerivatives (Albany::Application& app, const double time,
                        const Teuchos::RCP<const Tpetra_Vector>& x,
                        const Teuchos::Array<ParamVec>& p,
                        const Teuchos::RCP<const Tpetra_Vector>& fi,
-                       const Teuchos::RCP<const Tpetra_CrsMatrix>& jacobian,
+                       const Teuchos::RCP<const Tpetra_Operator>& jacobian,
                        const int check_lvl) {
   if (check_lvl <= 0) return;
 
@@ -1055,8 +1237,287 @@ void checkDerivatives (Albany::Application& app, const double time,
     ++ctr;
   }
 }
+
+// Bytes of one solution-sized scalar per workset dof; the unit the hot-path
+// profiler uses to report fill traffic.
+inline util::Counter::counter_type
+worksetDofBytes (
+  const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > >& elNodeEqID)
+{
+  if (elNodeEqID.size() == 0 || elNodeEqID[0].size() == 0) return 0;
+  return elNodeEqID.size() * elNodeEqID[0].size() * elNodeEqID[0][0].size()
+    * sizeof(ST);
+}
+
+// Element-Jacobian bytes: a dense element row per workset dof plus the residual.
+inline util::Counter::counter_type
+worksetJacobianBytes (
+  const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > >& elNodeEqID)
+{
+  if (elNodeEqID.size() == 0 || elNodeEqID[0].size() == 0) return 0;
+  const std::size_t nodeDofs = elNodeEqID[0].size() * elNodeEqID[0][0].size();
+  return worksetDofBytes(elNodeEqID) * (nodeDofs + 1);
+}
 } // namespace
 
+void
+Albany::Application::
+setupParallelWorksetFill()
+{
+  // Thread 0 uses the problem's own field managers; every other thread gets
+  // an independent copy of the volumetric evaluator graph, so that each
+  // thread owns its MDField storage. Duplicate state registrations are
+  // ignored by the StateManager.
+  threadFm.resize(numFillThreads);
+  threadFm[0] = problem->getFieldManager();
+  for (int t=1; t < numFillThreads; t++) {
+    threadFm[t].resize(meshSpecs.size());
+    for (int ps=0; ps < meshSpecs.size(); ps++) {
+      threadFm[t][ps] = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+      problem->buildEvaluators(*threadFm[t][ps], *meshSpecs[ps], stateMgr,
+                               BUILD_RESID_FM, Teuchos::null);
+    }
+  }
+
+  *out << "Parallel Workset Fill enabled with " << numFillThreads
+       << " fill threads" << std::endl;
+}
+
+template <typename EvalT>
+void
+Albany::Application::
+evaluateWorksetsParallel(const PHAL::Workset& workset, Teuchos::Array<double>* fillTime)
+{
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type&
+        wsElNodeEqID = disc->getWsElNodeEqID();
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const int numWorksets = wsElNodeEqID.size();
+
+  // (Re)color the worksets on first use and whenever the mesh changed.
+  if (wsColorsMeshGeneration != disc->getMeshGeneration()) {
+    wsColors = Albany::colorWorksets(wsElNodeEqID);
+    wsColorsMeshGeneration = disc->getMeshGeneration();
+    *out << "Parallel Workset Fill: " << numWorksets << " worksets in "
+         << wsColors.size() << " colors" << std::endl;
+  }
+
+  for (int c=0; c < wsColors.size(); c++) {
+    Teuchos::Array<int> color;
+    for (int i=0; i < wsColors[c].size(); i++)
+      if (isSampledWorkset(wsColors[c][i])) color.push_back(wsColors[c][i]);
+
+    // Worksets are loaded on this thread: loadWorksetBucketInfo copies
+    // ArrayRCPs and allocates Kokkos views, neither of which we want racing.
+    Teuchos::Array<PHAL::Workset> worksets(color.size(), workset);
+    for (int i=0; i < color.size(); i++)
+      loadWorksetBucketInfo<EvalT>(worksets[i], color[i]);
+
+    // No two worksets of this color share an overlapped row, so their
+    // scatters into the overlapped residual and Jacobian do not conflict.
+    Albany::parallelForWorksets(color.size(), numFillThreads,
+      [&](const int i, const int tid) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        threadFm[tid][wsPhysIndex[color[i]]]->template evaluateFields<EvalT>(worksets[i]);
+        if (fillTime != NULL)
+          (*fillTime)[color[i]] = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+      });
+  }
+
+  // Neumann field managers are not replicated; run them serially.
+  if (Teuchos::nonnull(nfm)) {
+    PHAL::Workset nworkset(workset);
+    for (int ws=0; ws < numWorksets; ws++) {
+      if (!isSampledWorkset(ws)) continue;
+      loadWorksetBucketInfo<EvalT>(nworkset, ws);
+      deref_nfm(nfm, wsPhysIndex, ws)->template evaluateFields<EvalT>(nworkset);
+    }
+  }
+}
+
+void
+Albany::Application::
+checkParallelResidualFill(PHAL::Workset& workset)
+{
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const int numWorksets = disc->getWsElNodeEqID().size();
+
+  const Teuchos::RCP<Tpetra_Vector> threadedT =
+    Teuchos::rcp(new Tpetra_Vector(*workset.fT, Teuchos::Copy));
+  workset.fT->putScalar(0.0);
+  for (int ws=0; ws < numWorksets; ws++) {
+    if (!isSampledWorkset(ws)) continue;
+    loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+    fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+    if (Teuchos::nonnull(nfm))
+      deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+  }
+
+  // Rows are summed in a different order, so allow for rounding
+  const ST norm = workset.fT->normInf();
+  threadedT->update(-1.0, *workset.fT, 1.0);
+  const ST diff = threadedT->normInf();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    diff > 1.0e-12 * std::max<ST>(norm, 1.0), std::logic_error,
+    "Parallel Workset Fill Check: the threaded residual differs from the serial "
+    "residual by " << diff << " (inf-norm " << norm << ")" << std::endl);
+  *out << "Parallel Workset Fill Check: threaded and serial residuals differ by "
+       << diff << std::endl;
+}
+
+void
+Albany::Application::
+setupFusedResponses()
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(numFillThreads > 1, Teuchos::Exceptions::InvalidParameter,
+                             std::endl << "Error in Albany::Application: " <<
+                             "Fused Responses does not support Parallel Workset Fill" << std::endl);
+
+  // A response fuses into the field manager of its physics set only when it
+  // covers exactly the worksets of that physics set in its own loop
+  fusedResponsePS.assign(responses.size(), -1);
+  fusedResponseValues.resize(responses.size());
+  fusedResponseFresh.assign(responses.size(), false);
+  ffm.resize(meshSpecs.size());
+  fusedResponseParams.resize(meshSpecs.size());
+  int numFused = 0;
+  for (int ps=0; ps < meshSpecs.size(); ps++) {
+    const Teuchos::RCP<Teuchos::ParameterList> fusedList =
+      Teuchos::rcp(new Teuchos::ParameterList("Fused Responses"));
+    fusedList->set<std::string>("Name", "Fused Responses");
+    int n = 0;
+    for (int i=0; i < responses.size(); i++) {
+      const Teuchos::RCP<FieldManagerScalarResponseFunction> response =
+        Teuchos::rcp_dynamic_cast<FieldManagerScalarResponseFunction>(responses[i]);
+      if (Teuchos::is_null(response) || !response->isFusable() ||
+          response->getMeshSpecs().get() != meshSpecs[ps].get() ||
+          (meshSpecs.size() > 1 && !response->isRestrictedToElementBlock()))
+        continue;
+      fusedList->sublist(Albany::strint("Response", n++)) = response->getResponseParams();
+      fusedResponsePS[i] = ps;
+    }
+    if (n == 0) continue;
+    fusedList->set<int>("Number of Responses", n);
+    numFused += n;
+
+    // The name of the residual scatter tag is problem specific, so take it
+    // from a residual build. Duplicate state registrations are ignored.
+    PHX::FieldManager<PHAL::AlbanyTraits> residFm;
+    const Teuchos::Array< Teuchos::RCP<const PHX::FieldTag> > residTags =
+      problem->buildEvaluators(residFm, *meshSpecs[ps], stateMgr,
+                               BUILD_RESID_FM, Teuchos::null);
+
+    // The response build registers the whole volumetric graph; requiring
+    // the scatter as well makes it a residual field manager
+    ffm[ps] = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+    problem->buildEvaluators(*ffm[ps], *meshSpecs[ps], stateMgr,
+                             BUILD_RESPONSE_FM, fusedList);
+    ffm[ps]->requireField<PHAL::AlbanyTraits::Residual>(*residTags[0]);
+    fusedResponseParams[ps] = fusedList;
+  }
+
+  *out << "Fused Responses: " << numFused << " of " << responses.size()
+       << " responses evaluated in the residual fill" << std::endl;
+}
+
+void
+Albany::Application::
+collectFusedResponses(const double current_time,
+                      const Tpetra_Vector& xT,
+                      const Teuchos::Array<ParamVec>& p)
+{
+  typedef PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+  for (int i=0; i < responses.size(); i++) {
+    if (fusedResponsePS[i] < 0) continue;
+    const Teuchos::RCP<FieldManagerScalarResponseFunction> response =
+      Teuchos::rcp_dynamic_cast<FieldManagerScalarResponseFunction>(responses[i], true);
+    PHX::MDField<ScalarT> g(
+      dynamic_cast<const PHX::Tag<ScalarT>&>(*response->getResponseTag()));
+    ffm[fusedResponsePS[i]]->getFieldData<ScalarT, PHAL::AlbanyTraits::Residual>(g);
+
+    if (Teuchos::is_null(fusedResponseValues[i]))
+      fusedResponseValues[i] = Teuchos::rcp(new Tpetra_Vector(responses[i]->responseMapT()));
+    const Teuchos::ArrayRCP<ST> gView = fusedResponseValues[i]->get1dViewNonConst();
+    for (PHAL::MDFieldIterator<ScalarT> gr(g); ! gr.done(); ++gr)
+      gView[gr.idx()] = *gr;
+    fusedResponseFresh[i] = true;
+  }
+
+  // The state the values belong to
+  fusedX = Teuchos::rcp(new Tpetra_Vector(xT, Teuchos::Copy));
+  fusedTime = current_time;
+  fusedP.clear();
+  for (int l=0; l < p.size(); l++)
+    for (unsigned int k=0; k < p[l].size(); k++)
+      fusedP.push_back(p[l][k].baseValue);
+}
+
+bool
+Albany::Application::
+hasFusedResponse(const int response_index,
+                 const double current_time,
+                 const Tpetra_Vector& xT,
+                 const Teuchos::Array<ParamVec>& p) const
+{
+  if (!fusedResponses || !fusedResponseFresh[response_index] ||
+      current_time != fusedTime || !fusedX->getMap()->isSameAs(*xT.getMap()))
+    return false;
+
+  int j = 0;
+  for (int l=0; l < p.size(); l++)
+    for (unsigned int k=0; k < p[l].size(); k++, j++)
+      if (j >= fusedP.size() || p[l][k].baseValue != fusedP[j]) return false;
+  if (j != fusedP.size()) return false;
+
+  Tpetra_Vector dxT(xT, Teuchos::Copy);
+  dxT.update(-1.0, *fusedX, 1.0);
+  return dxT.normInf() == 0.0;
+}
+
+void
+Albany::Application::
+setSampleDofs(const Teuchos::ArrayView<const int>& sampleLIDs)
+{
+  // Mark the sampled entries, then their overlapped copies, so that every
+  // rank also fills its cells contributing to another rank's sampled rows
+  Tpetra_Vector sampledT(disc->getMapT());
+  {
+    const Teuchos::ArrayRCP<ST> sampledView = sampledT.get1dViewNonConst();
+    for (int i=0; i < sampleLIDs.size(); i++)
+      sampledView[sampleLIDs[i]] = 1.0;
+  }
+  Tpetra_Vector overlapSampledT(disc->getOverlapMapT());
+  overlapSampledT.doImport(sampledT, *solMgrT->get_importerT(), Tpetra::INSERT);
+  const Teuchos::ArrayRCP<const ST> overlapSampled = overlapSampledT.get1dView();
+
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type&
+        wsElNodeEqID = disc->getWsElNodeEqID();
+  const int numWorksets = wsElNodeEqID.size();
+
+  sampleWorksets.assign(numWorksets, false);
+  int numSampled = 0;
+  for (int ws=0; ws < numWorksets; ws++) {
+    bool sampled = false;
+    for (int cell=0; cell < wsElNodeEqID[ws].size() && !sampled; cell++)
+      for (int node=0; node < wsElNodeEqID[ws][cell].size() && !sampled; node++)
+        for (int eq=0; eq < wsElNodeEqID[ws][cell][node].size() && !sampled; eq++)
+          sampled = (overlapSampled[wsElNodeEqID[ws][cell][node][eq]] != 0.0);
+    sampleWorksets[ws] = sampled;
+    if (sampled) numSampled++;
+  }
+  sampleWorksetsMeshGeneration = disc->getMeshGeneration();
+
+  *out << "Sample Mesh Evaluation: filling " << numSampled << " of "
+       << numWorksets << " worksets" << std::endl;
+}
+
+void
+Albany::Application::
+clearSampleDofs()
+{
+  sampleWorksets.clear();
+}
+
 void
 Albany::Application::
 computeGlobalResidualImplT(
@@ -1140,19 +1601,68 @@ computeGlobalResidualImplT(
                              paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time") );
     workset.fT = overlapped_fT;
 
-    for (int ws=0; ws < numWorksets; ws++) {
-      loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+    if (measureFillCost) worksetFillTime.assign(numWorksets, 0.0);
+
+    // Fused Responses: responses integrate over the whole mesh, so a fill
+    // restricted to the sample mesh leaves them to their own loops
+    const bool fuse = fusedResponses && sampleWorksets.empty();
+    if (fusedResponses) fusedResponseFresh.assign(responses.size(), false);
+    if (fuse) {
+      // What setupBasicWorksetInfoT adds for the response evaluators, which
+      // reduce over the ranks in postEvaluate
+      workset.comm = commT;
+      workset.x_importerT = importerT;
+      for (int ps=0; ps < ffm.size(); ps++)
+        if (Teuchos::nonnull(ffm[ps]))
+          ffm[ps]->preEvaluate<PHAL::AlbanyTraits::Residual>(workset);
+    }
 
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
-      if (nfm!=Teuchos::null)
-         deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+    if (numFillThreads > 1) {
+      {
+        util::ProfileGuard guard("Albany Fill: Residual [parallel]");
+        evaluateWorksetsParallel<PHAL::AlbanyTraits::Residual>(
+          workset, measureFillCost ? &worksetFillTime : NULL);
+      }
+      if (checkParallelFill) checkParallelResidualFill(workset);
+    }
+    else {
+      for (int ws=0; ws < numWorksets; ws++) {
+        if (!isSampledWorkset(ws)) continue;
+        util::ProfileGuard guard("Albany Fill: Residual", wsEBNames[ws],
+                                 worksetDofBytes(wsElNodeEqID[ws]));
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+
+        // FillType template argument used to specialize Sacado
+        if (fuse && Teuchos::nonnull(ffm[wsPhysIndex[ws]]))
+          ffm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+        else
+          fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+        if (nfm!=Teuchos::null)
+           deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+        if (measureFillCost)
+          worksetFillTime[ws] = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+      }
+    }
+
+    if (measureFillCost) disc->addWorksetFillTime(worksetFillTime());
+
+    if (fuse) {
+      for (int ps=0; ps < ffm.size(); ps++)
+        if (Teuchos::nonnull(ffm[ps]))
+          ffm[ps]->postEvaluate<PHAL::AlbanyTraits::Residual>(workset);
+      collectFusedResponses(current_time, *xT, p);
     }
   // workset.wsElNodeEqID_kokkos =Kokkos:: View<int****, PHX::Device ("wsElNodeEqID_kokkos",workset. wsElNodeEqID.size(), workset. wsElNodeEqID[0].size(), workset. wsElNodeEqID[0][0].size());
   }
 
   // Assemble the residual into a non-overlapping vector
-  fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+  {
+    util::ProfileGuard guard("Albany Export: Residual",
+                             overlapped_fT->getLocalLength() * sizeof(ST));
+    fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+  }
   
   //Allocate scaleVec_ 
   if (scaleVec_ == Teuchos::null && scale != 1.0) { 
@@ -1210,6 +1720,7 @@ computeGlobalResidualImplT(
 #endif
 
     // FillType template argument used to specialize Sacado
+    util::ProfileGuard guard("Albany Dirichlet: Residual");
     dfm->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
   }
 
@@ -1342,19 +1853,17 @@ computeGlobalResidualT(
 
 void
 Albany::Application::
-computeGlobalJacobianImplT(const double alpha,
-               const double beta,
-               const double omega,
-                           const double current_time,
-                           const Teuchos::RCP<const Tpetra_Vector>& xdotT,
-                           const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
-                           const Teuchos::RCP<const Tpetra_Vector>& xT,
-                           const Teuchos::Array<ParamVec>& p,
-                           const Teuchos::RCP<Tpetra_Vector>& fT,
-                           const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
+fillJacobianWorksetsT(const double alpha,
+                      const double beta,
+                      const double omega,
+                      const double current_time,
+                      const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                      const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                      const Teuchos::RCP<const Tpetra_Vector>& xT,
+                      const Teuchos::Array<ParamVec>& p,
+                      const Teuchos::RCP<Tpetra_Vector>& fT,
+                      PHAL::Workset& workset)
 {
-  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
-
   postRegSetup("Jacobian");
 
   // Load connectivity map and coordinates
@@ -1367,15 +1876,9 @@ computeGlobalJacobianImplT(const double alpha,
 
   int numWorksets = wsElNodeEqID.size();
 
-  //Teuchos::RCP<Tpetra_Vector> overlapped_fT = solMgrT->get_overlapped_fT();
   Teuchos::RCP<Tpetra_Vector> overlapped_fT;
-  if(Teuchos::nonnull(fT)){
-	  overlapped_fT = solMgrT->get_overlapped_fT();
-  }else{
-	  overlapped_fT = Teuchos::null;
-  }
-  Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT = solMgrT->get_overlapped_jacT();
-  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+  if (Teuchos::nonnull(fT))
+    overlapped_fT = solMgrT->get_overlapped_fT();
 
   // Scatter x and xdot to the overlapped distribution
   solMgrT->scatterXT(*xT, xdotT.get(), xdotdotT.get());
@@ -1407,6 +1910,114 @@ computeGlobalJacobianImplT(const double alpha,
     fT->putScalar(0.0);
   }
 
+  // Set data in Workset struct, and perform fill via field manager
+  if (!paramLib->isParameter("Time")) {
+    loadBasicWorksetInfoT( workset, current_time );
+  }
+  else {
+    loadBasicWorksetInfoT( workset,
+        paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time") );
+  }
+
+  workset.fT        = overlapped_fT;
+  loadWorksetJacobianInfo(workset, alpha, beta, omega);
+
+  //fill Jacobian derivative dimensions:
+  for (int ps=0; ps < fm.size(); ps++){
+    (workset.Jacobian_deriv_dims).push_back(
+      PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(this, ps, explicit_scheme));
+  }
+
+  if (numFillThreads > 1) {
+    util::ProfileGuard guard("Albany Fill: Jacobian [parallel]");
+    evaluateWorksetsParallel<PHAL::AlbanyTraits::Jacobian>(workset);
+  }
+  else {
+    for (int ws=0; ws < numWorksets; ws++) {
+      if (!isSampledWorkset(ws)) continue;
+      util::ProfileGuard guard("Albany Fill: Jacobian", wsEBNames[ws],
+                               worksetJacobianBytes(wsElNodeEqID[ws]));
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+      if (Teuchos::nonnull(nfm))
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+    }
+  }
+}
+
+void
+Albany::Application::
+applyDirichletJacobianT(const double alpha,
+                        const double beta,
+                        const double omega,
+                        const double current_time,
+                        const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                        const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                        const Teuchos::RCP<const Tpetra_Vector>& xT,
+                        PHAL::Workset& workset)
+{
+  if (Teuchos::is_null(dfm)) return;
+
+  workset.m_coeff = alpha;
+  workset.n_coeff = omega;
+  workset.j_coeff = beta;
+
+  if ( paramLib->isParameter("Time") )
+    workset.current_time = paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time");
+  else
+    workset.current_time = current_time;
+
+  if (beta==0.0 && perturbBetaForDirichlets>0.0) workset.j_coeff = perturbBetaForDirichlets;
+
+  dfm_set(workset, xT, xdotT, xdotdotT, rc_mgr);
+
+  loadWorksetNodesetInfo(workset);
+
+  if (scaleBCdofs == true) {
+    setScaleBCDofs(workset);
+#ifdef WRITE_TO_MATRIX_MARKET
+    if (countScale == 0)
+      Tpetra_MatrixMarket_Writer::writeDenseFile("scale.mm", scaleVec_);
+#endif
+    countScale++;
+  }
+
+  workset.distParamLib = distParamLib;
+  workset.disc = disc;
+
+#if defined(ALBANY_LCM)
+  // Needed for more specialized Dirichlet BCs (e.g. Schwarz coupling)
+  workset.apps_ = apps_;
+  workset.current_app_ = Teuchos::rcp(this, false);
+#endif
+
+  // FillType template argument used to specialize Sacado
+  util::ProfileGuard guard("Albany Dirichlet: Jacobian");
+  dfm->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+}
+
+void
+Albany::Application::
+computeGlobalJacobianImplT(const double alpha,
+               const double beta,
+               const double omega,
+                           const double current_time,
+                           const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                           const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                           const Teuchos::RCP<const Tpetra_Vector>& xT,
+                           const Teuchos::Array<ParamVec>& p,
+                           const Teuchos::RCP<Tpetra_Vector>& fT,
+                           const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
+
+  Teuchos::RCP<Tpetra_Vector> overlapped_fT;
+  if (Teuchos::nonnull(fT))
+    overlapped_fT = solMgrT->get_overlapped_fT();
+  Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT = solMgrT->get_overlapped_jacT();
+  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
   // Zero out Jacobian
   jacT->resumeFill();
   jacT->setAllToScalar(0.0);
@@ -1424,40 +2035,32 @@ computeGlobalJacobianImplT(const double alpha,
   if ( ! overlapped_jacT->isFillActive())
     overlapped_jacT->resumeFill();
 
+  const Teuchos::RCP<const JacobianAssemblyPlan> jacAssemblyPlan = Teuchos::null;
+#else
+  // Scatter through cached value offsets if the discretization provides them
+  const Teuchos::RCP<const JacobianAssemblyPlan> jacAssemblyPlan = disc->getJacobianAssemblyPlan();
+  if (Teuchos::nonnull(jacAssemblyPlan)) {
+    // Makes getLocalMatrix() valid. The local matrix survives resumeFill,
+    // so this is done once per overlapped matrix, not on every fill.
+    if ( ! (planJacT.is_valid_ptr() && planJacT.get() == overlapped_jacT.get())) {
+      overlapped_jacT->fillComplete();
+      planJacT = overlapped_jacT.create_weak();
+    }
+    if ( ! overlapped_jacT->isFillActive())
+      overlapped_jacT->resumeFill();
+  }
 #endif
 
-  // Set data in Workset struct, and perform fill via field manager
   {
     PHAL::Workset workset;
-    if (!paramLib->isParameter("Time")) {
-      loadBasicWorksetInfoT( workset, current_time );
-    }
-    else {
-      loadBasicWorksetInfoT( workset,
-          paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time") );
-    }
-
-    workset.fT        = overlapped_fT;
     workset.JacT      = overlapped_jacT;
-    loadWorksetJacobianInfo(workset, alpha, beta, omega);
-
-   //fill Jacobian derivative dimensions:
-   for (int ps=0; ps < fm.size(); ps++){
-      (workset.Jacobian_deriv_dims).push_back(
-        PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(this, ps, explicit_scheme));
-   }
-
-
-    for (int ws=0; ws < numWorksets; ws++) {
-      loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
-      if (Teuchos::nonnull(nfm))
-        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
-    }
+    workset.jacAssemblyPlan = jacAssemblyPlan;
+    fillJacobianWorksetsT(alpha, beta, omega, current_time, xdotT, xdotdotT, xT, p, fT, workset);
   }
 
   { TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian Export");
+  util::ProfileGuard guard("Albany Export: Jacobian",
+                           overlapped_jacT->getNodeNumEntries() * (sizeof(ST) + sizeof(LO)));
   //Allocate and populate scaleVec_  
   if (scaleVec_ == Teuchos::null && scale != 1.0) { 
     scaleVec_ = Teuchos::rcp(new Tpetra_Vector(fT->getMap())); 
@@ -1516,46 +2119,11 @@ computeGlobalJacobianImplT(const double alpha,
   }
   } // End timer
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
-  if (Teuchos::nonnull(dfm)) {
+  {
     PHAL::Workset workset;
-
     workset.fT = fT;
     workset.JacT = jacT;
-    workset.m_coeff = alpha;
-    workset.n_coeff = omega;
-    workset.j_coeff = beta;
-
-    if ( paramLib->isParameter("Time") )
-      workset.current_time = paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time");
-    else
-      workset.current_time = current_time;
-
-    if (beta==0.0 && perturbBetaForDirichlets>0.0) workset.j_coeff = perturbBetaForDirichlets;
-
-    dfm_set(workset, xT, xdotT, xdotdotT, rc_mgr);
-
-    loadWorksetNodesetInfo(workset);
-    
-    if (scaleBCdofs == true) {
-      setScaleBCDofs(workset); 
-#ifdef WRITE_TO_MATRIX_MARKET
-      if (countScale == 0)  
-        Tpetra_MatrixMarket_Writer::writeDenseFile("scale.mm", scaleVec_);
-#endif
-      countScale++; 
-    }
-
-    workset.distParamLib = distParamLib;
-    workset.disc = disc;
-
-#if defined(ALBANY_LCM)
-    // Needed for more specialized Dirichlet BCs (e.g. Schwarz coupling)
-    workset.apps_ = apps_;
-    workset.current_app_ = Teuchos::rcp(this, false);
-#endif
-
-    // FillType template argument used to specialize Sacado
-    dfm->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+    applyDirichletJacobianT(alpha, beta, omega, current_time, xdotT, xdotdotT, xT, workset);
   }
   jacT->fillComplete();
   
@@ -1577,6 +2145,113 @@ computeGlobalJacobianImplT(const double alpha,
                      derivatives_check_);
 }
 
+void
+Albany::Application::
+computeGlobalBlockJacobianT(const double alpha,
+                            const double beta,
+                            const double omega,
+                            const double current_time,
+                            const Tpetra_Vector* xdotT,
+                            const Tpetra_Vector* xdotdotT,
+                            const Tpetra_Vector& xT,
+                            const Teuchos::Array<ParamVec>& p,
+                            Tpetra_Vector* fT,
+                            Tpetra_BlockCrsMatrix& jacT)
+{
+  // (Re)build the overlapped block matrix after a remesh
+  if (disc->getOverlapNodeJacobianGraphT() != overlapNodeGraphT) {
+    overlapNodeGraphT = disc->getOverlapNodeJacobianGraphT();
+    overlapped_jacBlockT = Teuchos::rcp(new Tpetra_BlockCrsMatrix(*overlapNodeGraphT, neq));
+  }
+
+  computeGlobalBlockJacobianImplT(alpha, beta, omega, current_time,
+                                  Teuchos::rcp(xdotT, false), Teuchos::rcp(xdotdotT, false),
+                                  Teuchos::rcpFromRef(xT), p, Teuchos::rcp(fT, false),
+                                  *overlapped_jacBlockT, jacT);
+
+  if (derivatives_check_ > 0)
+    checkDerivatives(*this, current_time, Teuchos::rcp(xdotT, false),
+                     Teuchos::rcp(xdotdotT, false), Teuchos::rcpFromRef(xT), p,
+                     Teuchos::rcp(fT, false), Teuchos::rcpFromRef(jacT),
+                     derivatives_check_);
+}
+
+void
+Albany::Application::
+computeGlobalBlockDiagonalJacobianT(const double alpha,
+                                    const double beta,
+                                    const double omega,
+                                    const double current_time,
+                                    const Tpetra_Vector* xdotT,
+                                    const Tpetra_Vector* xdotdotT,
+                                    const Tpetra_Vector& xT,
+                                    const Teuchos::Array<ParamVec>& p,
+                                    Tpetra_Vector* fT,
+                                    Tpetra_BlockCrsMatrix& jacT)
+{
+  // The full element Jacobians are still evaluated; the scatter drops
+  // the blocks that are not in the diagonal graph.
+  getNodeBlockDiagonalGraphT();
+  computeGlobalBlockJacobianImplT(alpha, beta, omega, current_time,
+                                  Teuchos::rcp(xdotT, false), Teuchos::rcp(xdotdotT, false),
+                                  Teuchos::rcpFromRef(xT), p, Teuchos::rcp(fT, false),
+                                  *overlapped_jacBlockDiagT, jacT);
+}
+
+const Tpetra_Export&
+Albany::Application::
+getNodeExporterT()
+{
+  if (Teuchos::is_null(nodeExporterT) ||
+      nodeExporterT->getSourceMap() != disc->getOverlapNodeMapT())
+    nodeExporterT = Teuchos::rcp(new Tpetra_Export(disc->getOverlapNodeMapT(), disc->getNodeMapT()));
+  return *nodeExporterT;
+}
+
+void
+Albany::Application::
+computeGlobalBlockJacobianImplT(const double alpha,
+                                const double beta,
+                                const double omega,
+                                const double current_time,
+                                const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                const Teuchos::Array<ParamVec>& p,
+                                const Teuchos::RCP<Tpetra_Vector>& fT,
+                                Tpetra_BlockCrsMatrix& overlappedJacT,
+                                Tpetra_BlockCrsMatrix& jacT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(scale != 1.0 || scaleBCdofs == true, std::logic_error,
+    "Block CRS Jacobian storage does not support Jacobian scaling." << std::endl);
+
+  // Zero out Jacobian
+  jacT.setAllToScalar(0.0);
+  overlappedJacT.setAllToScalar(0.0);
+
+  {
+    PHAL::Workset workset;
+    workset.JacBlockT = Teuchos::rcpFromRef(overlappedJacT);
+    fillJacobianWorksetsT(alpha, beta, omega, current_time, xdotT, xdotdotT, xT, p, fT, workset);
+  }
+
+  { TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian Export");
+  if (Teuchos::nonnull(fT))
+    fT->doExport(*solMgrT->get_overlapped_fT(), *solMgrT->get_exporterT(), Tpetra::ADD);
+  jacT.doExport(overlappedJacT, getNodeExporterT(), Tpetra::ADD);
+  } // End timer
+
+  // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  {
+    PHAL::Workset workset;
+    workset.fT = fT;
+    workset.JacBlockT = Teuchos::rcpFromRef(jacT);
+    applyDirichletJacobianT(alpha, beta, omega, current_time, xdotT, xdotdotT, xT, workset);
+  }
+}
+
 #if defined(ALBANY_EPETRA)
 void
 Albany::Application::
@@ -2193,6 +2868,70 @@ computeGlobalTangentT(const double alpha,
       Teuchos::rcp(fT, false), Teuchos::rcp(JVT, false), Teuchos::rcp(fpT, false));
 }
 
+void
+Albany::Application::
+computeLumpedMassT(const double current_time,
+                   const Tpetra_Vector* xdotT,
+                   const Tpetra_Vector* xdotdotT,
+                   const Tpetra_Vector& xT,
+                   const Teuchos::Array<ParamVec>& par,
+                   Tpetra_Vector& massT)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(xdotdotT == NULL, std::logic_error,
+    "Error! computeLumpedMassT needs xdotdot for the inertia terms." << std::endl);
+
+  // The row sums are M*1: one Tangent fill in the direction xdotdot = 1.
+  // The x direction is zero, but the Dirichlet fill reads it.
+  const Teuchos::RCP<const Tpetra_Map> mapT = xT.getMap();
+  Tpetra_MultiVector VxT(mapT, 1, true);
+  Tpetra_MultiVector VxdotdotT(mapT, 1);
+  VxdotdotT.putScalar(1.0);
+  Tpetra_MultiVector JVT(mapT, 1, true);
+
+  computeGlobalTangentT(0.0, 0.0, 1.0, current_time, false, xdotT, xdotdotT, xT,
+                        par, NULL, &VxT, NULL, &VxdotdotT, NULL, NULL, &JVT, NULL);
+
+  massT.update(1.0, *JVT.getVector(0), 0.0);
+}
+
+void Albany::Application::
+computeDirichletRowsT(const double current_time,
+                      const Tpetra_Vector* xdotT,
+                      const Tpetra_Vector* xdotdotT,
+                      const Tpetra_Vector& xT,
+                      Tpetra_Vector& dbcT)
+{
+  dbcT.putScalar(0.0);
+  if (dfm == Teuchos::null) return;
+
+  // The Dirichlet evaluators overwrite the residual on their own rows only:
+  // start from NaN everywhere and see which rows were written.
+  const RCP<Tpetra_Vector> fT = rcp(new Tpetra_Vector(xT.getMap()));
+  fT->putScalar(std::numeric_limits<ST>::quiet_NaN());
+
+  PHAL::Workset workset;
+  workset.fT = fT;
+  loadWorksetNodesetInfo(workset);
+  dfm_set(workset, Teuchos::rcpFromRef(xT), Teuchos::rcp(xdotT, false),
+          Teuchos::rcp(xdotdotT, false), rc_mgr);
+  workset.current_time = current_time;
+  workset.distParamLib = distParamLib;
+  workset.disc = disc;
+
+#if defined(ALBANY_LCM)
+  // Needed for more specialized Dirichlet BCs (e.g. Schwarz coupling)
+  workset.apps_ = apps_;
+  workset.current_app_ = Teuchos::rcp(this, false);
+#endif
+
+  dfm->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+
+  const Teuchos::ArrayRCP<const ST> fView = fT->get1dView();
+  const Teuchos::ArrayRCP<ST> dbcView = dbcT.get1dViewNonConst();
+  for (LO i = 0; i < fView.size(); ++i)
+    dbcView[i] = (fView[i] == fView[i]) ? 1.0 : 0.0;
+}
+
 void Albany::Application::
 applyGlobalDistParamDerivImplT(const double current_time,
                                const Teuchos::RCP<const Tpetra_Vector> &xdotT,
@@ -2377,6 +3116,13 @@ evaluateResponseT(int response_index,
                  const Teuchos::Array<ParamVec>& p,
                  Tpetra_Vector& gT)
 {
+  // Fused Responses: the residual fill at this state already evaluated it
+  if (hasFusedResponse(response_index, current_time, xT, p)) {
+    gT.update(1.0, *fusedResponseValues[response_index], 0.0);
+    fusedResponseFresh[response_index] = false;
+    return;
+  }
+
   double t = current_time;
   if ( paramLib->isParameter("Time") )
     t = paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time");
@@ -3186,7 +3932,7 @@ evaluateSGResponseDerivative(
     sg_g, sg_dg_dx, sg_dg_dxdot, sg_dg_dxdotdot, sg_dg_dp);
 }
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 void
 Albany::Application::
 computeGlobalMPResidual(
@@ -3517,6 +4263,282 @@ for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  "
   }
 }
 
+#endif
+#ifdef ALBANY_ENSEMBLE
+void
+Albany::Application::
+allocateEnsembleOverlapT(const bool transient, const bool acceleration,
+                         const bool jacobian)
+{
+  const int nsamples = ALBANY_ENSEMBLE_SIZE;
+  const Teuchos::RCP<const Tpetra_Map> overlapMapT = disc->getOverlapMapT();
+
+  // Rebuild everything after the mesh changed
+  if (Teuchos::is_null(mp_overlapped_xT) ||
+      mp_overlapped_xT->getMap().get() != overlapMapT.get()) {
+    mp_overlapped_xT = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, nsamples));
+    mp_overlapped_fT = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, nsamples));
+    mp_overlapped_xdotT = Teuchos::null;
+    mp_overlapped_xdotdotT = Teuchos::null;
+  }
+  if (transient && Teuchos::is_null(mp_overlapped_xdotT))
+    mp_overlapped_xdotT = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, nsamples));
+  if (acceleration && Teuchos::is_null(mp_overlapped_xdotdotT))
+    mp_overlapped_xdotdotT = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, nsamples));
+
+  if (jacobian) {
+    const Teuchos::RCP<const Tpetra_CrsGraph> graphT = disc->getOverlapJacobianGraphT();
+    if (mp_overlapped_jacT.size() != nsamples ||
+        mp_overlapped_jacT[0]->getCrsGraph().get() != graphT.get()) {
+      mp_overlapped_jacT.resize(nsamples);
+      for (int i=0; i<nsamples; i++)
+        mp_overlapped_jacT[i] = Teuchos::rcp(new Tpetra_CrsMatrix(graphT));
+    }
+  }
+}
+
+void
+Albany::Application::
+computeGlobalEnsembleResidualT(
+  const double current_time,
+  const Tpetra_MultiVector* xdotT,
+  const Tpetra_MultiVector* xdotdotT,
+  const Tpetra_MultiVector& xT,
+  const Teuchos::Array<ParamVec>& p,
+  const Teuchos::Array<int>& mp_p_index,
+  const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+  Tpetra_MultiVector& fT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Ensemble Residual");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    xT.getNumVectors() != ALBANY_ENSEMBLE_SIZE ||
+    fT.getNumVectors() != ALBANY_ENSEMBLE_SIZE, std::logic_error,
+    "computeGlobalEnsembleResidualT: expected one column per sample ("
+    << ALBANY_ENSEMBLE_SIZE << "), got " << xT.getNumVectors() << " in x and "
+    << fT.getNumVectors() << " in f." << std::endl);
+
+  postRegSetup("MPResidual");
+
+  const WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const int numWorksets = wsEBNames.size();
+
+  allocateEnsembleOverlapT(xdotT != NULL, xdotdotT != NULL, false);
+  Teuchos::RCP<Tpetra_Import> importerT = solMgrT->get_importerT();
+  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
+  // Scatter all samples to the overlapped distribution at once
+  mp_overlapped_xT->doImport(xT, *importerT, Tpetra::INSERT);
+  if (xdotT != NULL) mp_overlapped_xdotT->doImport(*xdotT, *importerT, Tpetra::INSERT);
+  if (xdotdotT != NULL) mp_overlapped_xdotdotT->doImport(*xdotdotT, *importerT, Tpetra::INSERT);
+
+  // Zero out overlapped residual
+  mp_overlapped_fT->putScalar(0.0);
+  fT.putScalar(0.0);
+
+  // Set parameters
+  for (int i=0; i<p.size(); i++)
+    for (unsigned int j=0; j<p[i].size(); j++)
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+
+  // Set MP parameters
+  for (int i=0; i<mp_p_index.size(); i++) {
+    int ii = mp_p_index[i];
+    for (unsigned int j=0; j<p[ii].size(); j++)
+      p[ii][j].family->setValue<PHAL::AlbanyTraits::MPResidual>(mp_p_vals[ii][j]);
+  }
+
+  // Set data in Workset struct, and perform fill via field manager
+  {
+    PHAL::Workset workset;
+
+    workset.numEqs = neq;
+    workset.mp_xT = mp_overlapped_xT;
+    if (xdotT != NULL) workset.mp_xdotT = mp_overlapped_xdotT;
+    if (xdotdotT != NULL) workset.mp_xdotdotT = mp_overlapped_xdotdotT;
+    workset.mp_fT = mp_overlapped_fT;
+
+    workset.current_time = current_time;
+    workset.distParamLib = distParamLib;
+    workset.disc = disc;
+    workset.transientTerms = (xdotT != NULL);
+    workset.accelerationTerms = (xdotdotT != NULL);
+
+    for (int ws=0; ws < numWorksets; ws++) {
+      util::ProfileGuard guard("Albany Fill: Ensemble Residual", wsEBNames[ws], 0);
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::MPResidual>(workset, ws);
+
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+      if (nfm!=Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+    }
+  }
+
+  // Assemble global residual
+  fT.doExport(*mp_overlapped_fT, *exporterT, Tpetra::ADD);
+
+  // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  if (dfm!=Teuchos::null) {
+    PHAL::Workset workset;
+
+    workset.mp_fT = Teuchos::rcpFromRef(fT);
+    workset.mp_xT = Teuchos::rcpFromRef(xT);
+    loadWorksetNodesetInfo(workset);
+    workset.distParamLib = distParamLib;
+    workset.current_time = current_time;
+    workset.transientTerms = (xdotT != NULL);
+    workset.accelerationTerms = (xdotdotT != NULL);
+
+    workset.disc = disc;
+
+#if defined(ALBANY_LCM)
+    // Needed for more specialized Dirichlet BCs (e.g. Schwarz coupling)
+    workset.apps_ = apps_;
+    workset.current_app_ = Teuchos::rcp(this, false);
+#endif
+
+    // FillType template argument used to specialize Sacado
+    dfm->evaluateFields<PHAL::AlbanyTraits::MPResidual>(workset);
+  }
+}
+
+void
+Albany::Application::
+computeGlobalEnsembleJacobianT(
+  const double alpha,
+  const double beta,
+  const double omega,
+  const double current_time,
+  const Tpetra_MultiVector* xdotT,
+  const Tpetra_MultiVector* xdotdotT,
+  const Tpetra_MultiVector& xT,
+  const Teuchos::Array<ParamVec>& p,
+  const Teuchos::Array<int>& mp_p_index,
+  const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+  Tpetra_MultiVector* fT,
+  const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& jacT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Ensemble Jacobian");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    xT.getNumVectors() != ALBANY_ENSEMBLE_SIZE ||
+    jacT.size() != ALBANY_ENSEMBLE_SIZE ||
+    (fT != NULL && fT->getNumVectors() != ALBANY_ENSEMBLE_SIZE), std::logic_error,
+    "computeGlobalEnsembleJacobianT: expected one column and one Jacobian per sample ("
+    << ALBANY_ENSEMBLE_SIZE << "), got " << xT.getNumVectors() << " columns in x and "
+    << jacT.size() << " Jacobians." << std::endl);
+
+  postRegSetup("MPJacobian");
+
+  const WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const int numWorksets = wsEBNames.size();
+
+  allocateEnsembleOverlapT(xdotT != NULL, xdotdotT != NULL, true);
+  Teuchos::RCP<Tpetra_Import> importerT = solMgrT->get_importerT();
+  Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
+  // Scatter all samples to the overlapped distribution at once
+  mp_overlapped_xT->doImport(xT, *importerT, Tpetra::INSERT);
+  if (xdotT != NULL) mp_overlapped_xdotT->doImport(*xdotT, *importerT, Tpetra::INSERT);
+  if (xdotdotT != NULL) mp_overlapped_xdotdotT->doImport(*xdotdotT, *importerT, Tpetra::INSERT);
+
+  // Zero out overlapped residual and Jacobians
+  if (fT != NULL) {
+    mp_overlapped_fT->putScalar(0.0);
+    fT->putScalar(0.0);
+  }
+  for (int i=0; i<jacT.size(); i++) {
+    jacT[i]->resumeFill();
+    jacT[i]->setAllToScalar(0.0);
+    if (!mp_overlapped_jacT[i]->isFillActive())
+      mp_overlapped_jacT[i]->resumeFill();
+    mp_overlapped_jacT[i]->setAllToScalar(0.0);
+  }
+
+  // Set parameters
+  for (int i=0; i<p.size(); i++)
+    for (unsigned int j=0; j<p[i].size(); j++)
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+
+  // Set MP parameters
+  for (int i=0; i<mp_p_index.size(); i++) {
+    int ii = mp_p_index[i];
+    for (unsigned int j=0; j<p[ii].size(); j++)
+      p[ii][j].family->setValue<PHAL::AlbanyTraits::MPJacobian>(mp_p_vals[ii][j]);
+  }
+
+  // Set data in Workset struct, and perform fill via field manager
+  {
+    PHAL::Workset workset;
+
+    workset.numEqs = neq;
+    workset.mp_xT = mp_overlapped_xT;
+    if (xdotT != NULL) workset.mp_xdotT = mp_overlapped_xdotT;
+    if (xdotdotT != NULL) workset.mp_xdotdotT = mp_overlapped_xdotdotT;
+    if (fT != NULL) workset.mp_fT = mp_overlapped_fT;
+    workset.mp_JacT = mp_overlapped_jacT;
+    loadWorksetJacobianInfo(workset, alpha, beta, omega);
+
+    workset.current_time = current_time;
+    workset.distParamLib = distParamLib;
+    workset.disc = disc;
+    workset.transientTerms = (xdotT != NULL);
+    workset.accelerationTerms = (xdotdotT != NULL);
+
+    for (int ws=0; ws < numWorksets; ws++) {
+      util::ProfileGuard guard("Albany Fill: Ensemble Jacobian", wsEBNames[ws], 0);
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::MPJacobian>(workset, ws);
+
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+      if (nfm!=Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+    }
+  }
+
+  // Assemble global residual and Jacobians
+  if (fT != NULL)
+    fT->doExport(*mp_overlapped_fT, *exporterT, Tpetra::ADD);
+  for (int i=0; i<jacT.size(); i++)
+    jacT[i]->doExport(*mp_overlapped_jacT[i], *exporterT, Tpetra::ADD);
+
+  // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  if (dfm!=Teuchos::null) {
+    PHAL::Workset workset;
+
+    if (fT != NULL) workset.mp_fT = Teuchos::rcp(fT, false);
+    workset.mp_JacT = jacT;
+    workset.mp_xT = Teuchos::rcpFromRef(xT);
+    workset.j_coeff = beta;
+    workset.n_coeff = omega;
+    workset.current_time = current_time;
+    workset.transientTerms = (xdotT != NULL);
+    workset.accelerationTerms = (xdotdotT != NULL);
+
+    loadWorksetNodesetInfo(workset);
+    workset.distParamLib = distParamLib;
+
+    workset.disc = disc;
+
+#if defined(ALBANY_LCM)
+    // Needed for more specialized Dirichlet BCs (e.g. Schwarz coupling)
+    workset.apps_ = apps_;
+    workset.current_app_ = Teuchos::rcp(this, false);
+#endif
+
+    // FillType template argument used to specialize Sacado
+    dfm->evaluateFields<PHAL::AlbanyTraits::MPJacobian>(workset);
+  }
+
+  for (int i=0; i<jacT.size(); i++)
+    jacT[i]->fillComplete();
+}
+
+#endif
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 void
 Albany::Application::
 computeGlobalMPTangent(
@@ -4057,6 +5079,21 @@ Albany::Application::getValue(const std::string& name)
 }
 
 
+namespace {
+// A fixed-size FadType only fits the element type it was compiled for
+void checkFadSize(const int derivativeDimension, const Albany::MeshSpecsStruct& ms)
+{
+#ifdef ALBANY_SFAD_SIZE
+  TEUCHOS_TEST_FOR_EXCEPTION(derivativeDimension != ALBANY_SFAD_SIZE, std::logic_error,
+                             "Error in Albany::Application: element block " << ms.ebName <<
+                             " (" << ms.ctd.name << ") needs " << derivativeDimension <<
+                             " derivatives, but Albany was configured with SFAD_ELEMENT for " <<
+                             ALBANY_SFAD_SIZE << ".\nReconfigure with the matching SFAD_ELEMENT," <<
+                             " or without it to use DFad." << std::endl);
+#endif
+}
+} // namespace
+
 void Albany::Application::
 postRegSetup(std::string eval)
 {
@@ -4067,6 +5104,12 @@ postRegSetup(std::string eval)
   if (eval=="Residual") {
     for (int ps=0; ps < fm.size(); ps++)
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
+    for (int t=1; t < threadFm.size(); t++)
+      for (int ps=0; ps < threadFm[t].size(); ps++)
+        threadFm[t][ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
+    for (int ps=0; ps < ffm.size(); ps++)
+      if (Teuchos::nonnull(ffm[ps]))
+        ffm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (dfm!=Teuchos::null)
       dfm->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (nfm!=Teuchos::null)
@@ -4078,8 +5121,13 @@ postRegSetup(std::string eval)
       std::vector<PHX::index_size_type> derivative_dimensions;
       derivative_dimensions.push_back(
         PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(this, ps, explicit_scheme));
+      checkFadSize(derivative_dimensions[0], *meshSpecs[ps]);
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      for (int t=1; t < threadFm.size(); t++) {
+        threadFm[t][ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(derivative_dimensions);
+        threadFm[t][ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      }
       if (nfm!=Teuchos::null && ps < nfm.size()) {
         nfm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(derivative_dimensions);
         nfm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
@@ -4339,9 +5387,10 @@ Albany::Application::determinePiroSolver(const Teuchos::RCP<Teuchos::ParameterLi
         secondOrder != "No" &&
         secondOrder != "Velocity Verlet" &&
         secondOrder != "Newmark" &&
-        secondOrder != "Trapezoid Rule",
+        secondOrder != "Trapezoid Rule" &&
+        secondOrder != "Central Difference",
         std::logic_error,
-        "Invalid value for Second Order: (No, Velocity Verlet, Newmark, Trapezoid Rule): " <<
+        "Invalid value for Second Order: (No, Velocity Verlet, Newmark, Trapezoid Rule, Central Difference): " <<
         secondOrder <<
         "\n");
 
@@ -4681,7 +5730,7 @@ void Albany::Application::setupBasicWorksetInfo(
 }
 
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 void Albany::Application::setupBasicWorksetInfo(
   PHAL::Workset& workset,
   double current_time,
@@ -5050,7 +6099,7 @@ void Albany::Application::setupTangentWorksetInfo(
 }
 
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void Albany::Application::setupTangentWorksetInfo(
   PHAL::Workset& workset,
@@ -128,6 +128,12 @@ namespace Albany {
     //! Get Tpetra Jacobian graph
     Teuchos::RCP<const Tpetra_CrsGraph> getJacobianGraphT() const;
 
+    //! Get node-to-node Tpetra Jacobian graph, null unless Block CRS storage is used
+    Teuchos::RCP<const Tpetra_CrsGraph> getNodeJacobianGraphT() const;
+
+    //! Get owned node graph holding only the diagonal entries (block Jacobi)
+    Teuchos::RCP<const Tpetra_CrsGraph> getNodeBlockDiagonalGraphT();
+
 #if defined(ALBANY_EPETRA)
     //! Get Preconditioner Operator
     Teuchos::RCP<Epetra_Operator> getPreconditioner();
@@ -249,8 +255,71 @@ namespace Albany {
                                  Tpetra_Vector* fT,
                                  Tpetra_CrsMatrix& jacT);
 
+     //! Compute global Jacobian into a BlockCrsMatrix (Block CRS storage)
+     void computeGlobalBlockJacobianT(const double alpha,
+                                      const double beta,
+                                      const double omega,
+                                      const double current_time,
+                                      const Tpetra_Vector* xdotT,
+                                      const Tpetra_Vector* xdotdotT,
+                                      const Tpetra_Vector& xT,
+                                      const Teuchos::Array<ParamVec>& p,
+                                      Tpetra_Vector* fT,
+                                      Tpetra_BlockCrsMatrix& jacT);
+
+     //! Compute the node diagonal blocks of the global Jacobian only
+     void computeGlobalBlockDiagonalJacobianT(const double alpha,
+                                              const double beta,
+                                              const double omega,
+                                              const double current_time,
+                                              const Tpetra_Vector* xdotT,
+                                              const Tpetra_Vector* xdotdotT,
+                                              const Tpetra_Vector& xT,
+                                              const Teuchos::Array<ParamVec>& p,
+                                              Tpetra_Vector* fT,
+                                              Tpetra_BlockCrsMatrix& jacT);
+
   private:
 
+     //! Element fill shared by the point and Block CRS Jacobians: sets the
+     //! state and parameters, zeroes fT and evaluates every workset into the
+     //! overlapped matrix already set on workset (JacT or JacBlockT).
+     void fillJacobianWorksetsT(const double alpha,
+                                const double beta,
+                                const double omega,
+                                const double current_time,
+                                const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                const Teuchos::Array<ParamVec>& p,
+                                const Teuchos::RCP<Tpetra_Vector>& fT,
+                                PHAL::Workset& workset);
+
+     //! Dirichlet conditions on the owned fT and Jacobian set on workset
+     void applyDirichletJacobianT(const double alpha,
+                                  const double beta,
+                                  const double omega,
+                                  const double current_time,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                  PHAL::Workset& workset);
+
+     void computeGlobalBlockJacobianImplT(const double alpha,
+                                          const double beta,
+                                          const double omega,
+                                          const double current_time,
+                                          const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                          const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                          const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                          const Teuchos::Array<ParamVec>& p,
+                                          const Teuchos::RCP<Tpetra_Vector>& fT,
+                                          Tpetra_BlockCrsMatrix& overlappedJacT,
+                                          Tpetra_BlockCrsMatrix& jacT);
+
+     //! Node exporter of the current discretization
+     const Tpetra_Export& getNodeExporterT();
+
      void computeGlobalJacobianImplT(const double alpha,
                                      const double beta,
                                      const double omega,
@@ -313,6 +382,24 @@ namespace Albany {
                               Tpetra_MultiVector* JVT,
                               Tpetra_MultiVector* fpT);
 
+     //! Row sums of the mass matrix df/dxdotdot, without forming it
+     /*!
+      * Used by explicit time integration. Rows of Dirichlet DOFs are zero.
+      */
+     void computeLumpedMassT(const double current_time,
+                             const Tpetra_Vector* xdotT,
+                             const Tpetra_Vector* xdotdotT,
+                             const Tpetra_Vector& xT,
+                             const Teuchos::Array<ParamVec>& p,
+                             Tpetra_Vector& massT);
+
+     //! Mark the rows set by the Dirichlet field manager with 1, others with 0
+     void computeDirichletRowsT(const double current_time,
+                                const Tpetra_Vector* xdotT,
+                                const Tpetra_Vector* xdotdotT,
+                                const Tpetra_Vector& xT,
+                                Tpetra_Vector& dbcT);
+
   private:
 
      void computeGlobalTangentImplT(const double alpha,
@@ -556,7 +643,7 @@ namespace Albany {
       const EpetraExt::ModelEvaluator::SGDerivative& sg_dg_dp);
 
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
     //! Compute global residual for stochastic Galerkin problem
     /*!
      * Set xdot to NULL for steady-state problems
@@ -677,6 +764,42 @@ namespace Albany {
       const EpetraExt::ModelEvaluator::MPDerivative& mp_dg_dxdotdot,
       const EpetraExt::ModelEvaluator::MPDerivative& mp_dg_dp);
 #endif
+#ifdef ALBANY_ENSEMBLE
+
+    //! Compute global residuals of an ensemble of samples in one fill
+    /*!
+     * Column i of the multivectors holds sample i; the number of columns
+     * must equal the ensemble size. Set xdot to NULL for steady-state problems.
+     */
+    void computeGlobalEnsembleResidualT(
+      const double current_time,
+      const Tpetra_MultiVector* xdotT,
+      const Tpetra_MultiVector* xdotdotT,
+      const Tpetra_MultiVector& xT,
+      const Teuchos::Array<ParamVec>& p,
+      const Teuchos::Array<int>& mp_p_index,
+      const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+      Tpetra_MultiVector& fT);
+
+    //! Compute global Jacobians of an ensemble of samples in one fill
+    /*!
+     * jacT holds one matrix per sample, on the Jacobian graph.
+     * Set xdot to NULL for steady-state problems.
+     */
+    void computeGlobalEnsembleJacobianT(
+      const double alpha,
+      const double beta,
+      const double omega,
+      const double current_time,
+      const Tpetra_MultiVector* xdotT,
+      const Tpetra_MultiVector* xdotdotT,
+      const Tpetra_MultiVector& xT,
+      const Teuchos::Array<ParamVec>& p,
+      const Teuchos::Array<int>& mp_p_index,
+      const Teuchos::Array< Teuchos::Array<MPType> >& mp_p_vals,
+      Tpetra_MultiVector* fT,
+      const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& jacT);
+#endif
 
     //! Provide access to shapeParameters -- no AD
     PHAL::AlbanyTraits::Residual::ScalarT& getValue(const std::string &n);
@@ -760,6 +883,54 @@ namespace Albany {
 
     void removeEpetraRelatedPLs(const Teuchos::RCP<Teuchos::ParameterList>& params);
 
+    //! Build the per-thread field managers used by the Parallel Workset Fill
+    //! mode. Must run before the state variables are allocated.
+    void setupParallelWorksetFill();
+
+    //! Auto Workset Size: shrink the workset size of all element blocks to
+    //! the largest that keeps the estimated field data of one Jacobian
+    //! workset within the cache. Must run before the problem is built.
+    void tuneWorksetSize();
+
+    //! Evaluate the volumetric field managers over all worksets, one color
+    //! at a time, with the worksets of each color spread over the fill threads.
+    //! If fillTime is given, the wall time of each workset is stored in it.
+    template <typename EvalT>
+    void evaluateWorksetsParallel(const PHAL::Workset& workset,
+                                  Teuchos::Array<double>* fillTime = NULL);
+
+    //! Refill the residual of workset.fT serially, over the worksets of the
+    //! threaded fill just done, and compare the two.
+    void checkParallelResidualFill(PHAL::Workset& workset);
+
+    //! Fused Responses: build the residual field managers that also evaluate
+    //! the field-manager responses. Must run before the state variables are allocated.
+    void setupFusedResponses();
+
+    //! Fused Responses: copy the response values out of ffm after a residual fill
+    void collectFusedResponses(const double current_time,
+                               const Tpetra_Vector& xT,
+                               const Teuchos::Array<ParamVec>& p);
+
+    //! Fused Responses: whether the last residual fill evaluated this
+    //! response at this state, and the value was not used yet
+    bool hasFusedResponse(const int response_index,
+                          const double current_time,
+                          const Tpetra_Vector& xT,
+                          const Teuchos::Array<ParamVec>& p) const;
+
+    //! Sample Mesh Evaluation: whether the fills evaluate workset ws
+    bool isSampledWorkset(const int ws) const
+    {
+      if (sampleWorksets.empty()) return true;
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        sampleWorksetsMeshGeneration != disc->getMeshGeneration() ||
+        ws >= static_cast<int>(sampleWorksets.size()), std::logic_error,
+        "Sample Mesh Evaluation: the mesh changed since setSampleDofs; "
+        "call it again." << std::endl);
+      return sampleWorksets[ws];
+    }
+
   public:
 
 
@@ -823,7 +994,7 @@ namespace Albany {
       const Teuchos::Array<int>& sg_p_index,
       const Teuchos::Array< Teuchos::Array<SGType> >& sg_p_vals);
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
     void setupBasicWorksetInfo(
       PHAL::Workset& workset,
@@ -883,7 +1054,7 @@ namespace Albany {
       const Epetra_MultiVector* Vx,
       const Epetra_MultiVector* Vp);
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
     void setupTangentWorksetInfo(
       PHAL::Workset& workset,
@@ -910,6 +1081,14 @@ namespace Albany {
 #endif
 #endif
 
+    //! Sample Mesh Evaluation: restrict the residual and Jacobian fills to
+    //! the worksets touching these owned solution entries (local ids). Only
+    //! the sampled rows are then exact. Must be redone when the mesh changes.
+    void setSampleDofs(const Teuchos::ArrayView<const int>& sampleLIDs);
+
+    //! Sample Mesh Evaluation: fill all worksets again
+    void clearSampleDofs();
+
 #if defined(ALBANY_LCM)
   // Needed for coupled Schwarz
   public:
@@ -1081,6 +1260,72 @@ namespace Albany {
     //! Phalanx Field Manager for states
     Teuchos::Array< Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits> > > sfm;
 
+    //! Auto Workset Size: enabled, and the cache size to fit, in bytes
+    //! (0 asks the system for its L2 cache size)
+    bool autoWorksetSize;
+    int worksetCacheSize;
+
+    //! Parallel Workset Fill: number of fill threads (1 = serial fill)
+    int numFillThreads;
+
+    //! Parallel Workset Fill Check: refill each threaded residual serially
+    //! and throw if the two differ
+    bool checkParallelFill;
+
+    //! Fill Cost: time each workset of the residual fills and report it to
+    //! the discretization, which may weigh its elements with it
+    bool measureFillCost;
+    Teuchos::Array<double> worksetFillTime;
+
+    //! Parallel Workset Fill: volumetric field managers for each fill
+    //! thread; threadFm[0] aliases fm
+    Teuchos::Array<Teuchos::ArrayRCP<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits> > > > threadFm;
+
+    //! Parallel Workset Fill: worksets grouped so that no two worksets of
+    //! the same color share an overlapped DOF
+    Teuchos::Array<Teuchos::Array<int> > wsColors;
+
+    //! Mesh generation of the discretization wsColors was computed for
+    int wsColorsMeshGeneration;
+
+    //! Fused Responses: per physics set, a residual field manager that also
+    //! evaluates the fused responses (null = none), and the parameters its
+    //! response evaluators point to
+    bool fusedResponses;
+    Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits> > > ffm;
+    Teuchos::Array<Teuchos::RCP<Teuchos::ParameterList> > fusedResponseParams;
+
+    //! Fused Responses: physics set of each response (-1 = not fused), and the
+    //! values of the last residual fill with the state they were computed at
+    Teuchos::Array<int> fusedResponsePS;
+    Teuchos::Array<Teuchos::RCP<Tpetra_Vector> > fusedResponseValues;
+    std::vector<bool> fusedResponseFresh;
+    Teuchos::RCP<Tpetra_Vector> fusedX;
+    double fusedTime;
+    Teuchos::Array<RealType> fusedP;
+
+    //! Sample Mesh Evaluation: worksets filled by the residual and Jacobian
+    //! (empty = all of them), and the mesh generation they were marked on
+    std::vector<bool> sampleWorksets;
+    int sampleWorksetsMeshGeneration;
+
+    //! Block CRS storage: overlapped block Jacobian, rebuilt whenever the
+    //! discretization's overlap node graph changes, and node exporter
+    Teuchos::RCP<const Tpetra_CrsGraph> overlapNodeGraphT;
+    Teuchos::RCP<Tpetra_BlockCrsMatrix> overlapped_jacBlockT;
+    Teuchos::RCP<Tpetra_Export> nodeExporterT;
+
+    //! Block Jacobi preconditioner: block diagonal graphs and overlapped
+    //! matrix, rebuilt whenever the mesh generation changes
+    Teuchos::RCP<const Tpetra_CrsGraph> nodeDiagGraphT;
+    Teuchos::RCP<const Tpetra_CrsGraph> overlapNodeDiagGraphT;
+    Teuchos::RCP<Tpetra_BlockCrsMatrix> overlapped_jacBlockDiagT;
+    int nodeDiagGraphMeshGeneration;
+
+    //! Overlapped Jacobian already fill-completed for the assembly plan;
+    //! weak, so that a new matrix at the address of a freed one is detected
+    Teuchos::RCP<const Tpetra_CrsMatrix> planJacT;
+
 #ifdef ALBANY_STOKHOS
     //! Stochastic Galerkin basis
     Teuchos::RCP<const Stokhos::OrthogPolyBasis<int,double> > sg_basis;
@@ -1128,6 +1373,21 @@ namespace Albany {
 #endif
 #endif
 
+#ifdef ALBANY_ENSEMBLE
+    //! Tpetra ensemble fill: overlapped samples, one column per sample
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xdotT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_xdotdotT;
+    Teuchos::RCP<Tpetra_MultiVector> mp_overlapped_fT;
+
+    //! Tpetra ensemble fill: overlapped Jacobian of each sample
+    Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> > mp_overlapped_jacT;
+
+    //! (Re)allocate the overlapped ensemble objects for the current mesh
+    void allocateEnsembleOverlapT(const bool transient, const bool acceleration,
+                                  const bool jacobian);
+#endif
+
     bool explicit_scheme; 
 
     //! Data for Physics-Based Preconditioners
@@ -1258,13 +1518,26 @@ void Albany::Application::loadWorksetBucketInfo(PHAL::Workset& workset,
  // workset.auxDataPtrT = stateMgr.getAuxDataT();
 
  
-//  workset.wsElNodeEqID_kokkos =
-  Kokkos:: View<int***, PHX::Device> wsElNodeEqID_kokkos ("wsElNodeEqID_kokkos",workset.numCells, wsElNodeEqID[ws][0].size(), wsElNodeEqID[ws][0][0].size());
-   workset.wsElNodeEqID_kokkos=wsElNodeEqID_kokkos;
-   for (int i=0; i< workset.numCells; i++) 
-      for (int j=0; j< wsElNodeEqID[ws][0].size(); j++)
-          for (int k=0; k<wsElNodeEqID[ws][0][0].size();k++)
-              workset.wsElNodeEqID_kokkos(i,j,k)=workset.wsElNodeEqID[i][j][k]; 
+  // Contiguous connectivity built once by the discretization; build it here
+  // for discretizations that do not provide it.
+  const WorksetArray<WsElNodeEqIDView>::type&
+        wsElNodeEqIDView = disc->getWsElNodeEqIDView();
+  if (wsElNodeEqIDView.size() == wsElNodeEqID.size()) {
+    workset.wsElNodeEqID_kokkos = wsElNodeEqIDView[ws];
+  }
+  else {
+    const int numNodes = workset.numCells > 0 ? wsElNodeEqID[ws][0].size() : 0;
+    const int numEqs = numNodes > 0 ? wsElNodeEqID[ws][0][0].size() : 0;
+    workset.wsElNodeEqID_kokkos =
+      WsElNodeEqIDView("wsElNodeEqID_kokkos", workset.numCells, numNodes, numEqs);
+    WsElNodeEqIDView::HostMirror eqID =
+      Kokkos::create_mirror_view(workset.wsElNodeEqID_kokkos);
+    for (int i=0; i < workset.numCells; i++)
+      for (int j=0; j < numNodes; j++)
+        for (int k=0; k < numEqs; k++)
+          eqID(i,j,k) = wsElNodeEqID[ws][i][j][k];
+    Kokkos::deep_copy(workset.wsElNodeEqID_kokkos, eqID);
+  }
 }
 
 #endif // ALBANY_APPLICATION_HPP
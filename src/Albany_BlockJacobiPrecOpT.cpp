@@ -0,0 +1,101 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_BlockJacobiPrecOpT.hpp"
+
+#include "Teuchos_LAPACK.hpp"
+#include "Teuchos_TestForException.hpp"
+
+Albany::BlockJacobiPrecOpT::
+BlockJacobiPrecOpT(const Teuchos::RCP<const Tpetra_CrsGraph>& diagGraphT_,
+                   const int blockSize,
+                   const Teuchos::RCP<const Tpetra_Map>& mapT_)
+  : bs(blockSize)
+{
+  setGraph(diagGraphT_, mapT_);
+}
+
+void Albany::BlockJacobiPrecOpT::
+setGraph(const Teuchos::RCP<const Tpetra_CrsGraph>& diagGraphT_,
+         const Teuchos::RCP<const Tpetra_Map>& mapT_)
+{
+  // diagGraphT keeps the old graph alive, so a new one never shares its address
+  if (diagGraphT_ == diagGraphT && mapT_ == mapT) return;
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    mapT_->getNodeNumElements() != diagGraphT_->getNodeNumRows()*bs, std::logic_error,
+    "BlockJacobiPrecOpT: the DOF map does not hold " << bs
+    << " DOFs per node." << std::endl);
+  diagGraphT = diagGraphT_;
+  mapT = mapT_;
+  diagT = Teuchos::rcp(new Tpetra_BlockCrsMatrix(*diagGraphT, bs));
+  invBlocks.clear();
+}
+
+void Albany::BlockJacobiPrecOpT::compute()
+{
+  const LO numRows = diagT->getNodeNumRows();
+  const int bs2 = bs*bs;
+  invBlocks.assign(numRows*bs2, 0.0);
+
+  Teuchos::LAPACK<int, ST> lapack;
+  std::vector<int> ipiv(bs);
+  std::vector<ST> work(bs);
+  int info;
+
+  for (LO row = 0; row < numRows; ++row) {
+    const LO* cols;
+    ST* vals;
+    LO numBlocks;
+    diagT->getLocalRowView(row, cols, vals, numBlocks);
+    TEUCHOS_TEST_FOR_EXCEPTION(numBlocks != 1, std::logic_error,
+      "BlockJacobiPrecOpT: node row " << row << " has " << numBlocks
+      << " blocks instead of one." << std::endl);
+
+    // Blocks are stored row-major; LAPACK wants column-major
+    ST* inv = &invBlocks[row*bs2];
+    for (int i = 0; i < bs; ++i)
+      for (int j = 0; j < bs; ++j)
+        inv[j*bs + i] = vals[i*bs + j];
+
+    lapack.GETRF(bs, bs, inv, bs, &ipiv[0], &info);
+    TEUCHOS_TEST_FOR_EXCEPTION(info != 0, std::runtime_error,
+      "BlockJacobiPrecOpT: diagonal block of node row " << row
+      << " is singular (GETRF info = " << info << ")." << std::endl);
+    lapack.GETRI(bs, inv, bs, &ipiv[0], &work[0], bs, &info);
+    TEUCHOS_TEST_FOR_EXCEPTION(info != 0, std::runtime_error,
+      "BlockJacobiPrecOpT: GETRI failed with info = " << info << std::endl);
+  }
+}
+
+void Albany::BlockJacobiPrecOpT::
+apply(const Tpetra_MultiVector& X,
+      Tpetra_MultiVector& Y, Teuchos::ETransp mode,
+      ST a, ST b) const
+{
+  const LO numRows = diagT->getNodeNumRows();
+  const int bs2 = bs*bs;
+  const bool trans = (mode != Teuchos::NO_TRANS);
+
+  // X and Y may alias
+  const Tpetra_MultiVector Xcopy(X, Teuchos::Copy);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > x = Xcopy.get2dView();
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > y = Y.get2dViewNonConst();
+
+  for (std::size_t k = 0; k < X.getNumVectors(); ++k) {
+    for (LO row = 0; row < numRows; ++row) {
+      const ST* inv = &invBlocks[row*bs2];
+      const ST* xb = &x[k][row*bs];
+      ST* yb = &y[k][row*bs];
+      for (int i = 0; i < bs; ++i) {
+        ST sum = 0.0;
+        for (int j = 0; j < bs; ++j)
+          sum += (trans ? inv[i*bs + j] : inv[j*bs + i]) * xb[j];
+        yb[i] = (b == Teuchos::ScalarTraits<ST>::zero()) ? a*sum : a*sum + b*yb[i];
+      }
+    }
+  }
+}
@@ -0,0 +1,78 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_BLOCK_JACOBI_PREC_OP_T_HPP
+#define ALBANY_BLOCK_JACOBI_PREC_OP_T_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+  //! Node block Jacobi preconditioner for the matrix-free Jacobian
+  /*!
+   * Holds only the neq x neq diagonal block of every owned node, which the
+   * Application fills with computeGlobalBlockDiagonalJacobianT. compute()
+   * inverts the blocks; apply() multiplies by the inverses. Requires
+   * interleaved DOF ordering.
+   */
+  class BlockJacobiPrecOpT : public Tpetra_Operator {
+  public:
+
+    //! The graph must hold the diagonal entry of each owned node only
+    BlockJacobiPrecOpT(const Teuchos::RCP<const Tpetra_CrsGraph>& diagGraphT,
+                       const int blockSize,
+                       const Teuchos::RCP<const Tpetra_Map>& mapT);
+
+    //! Destructor
+    virtual ~BlockJacobiPrecOpT() {}
+
+    //! Rebuild the block diagonal matrix if the graph changed, e.g. after
+    //! a remesh
+    void setGraph(const Teuchos::RCP<const Tpetra_CrsGraph>& diagGraphT,
+                  const Teuchos::RCP<const Tpetra_Map>& mapT);
+
+    //! Block diagonal matrix to be filled before compute()
+    Teuchos::RCP<Tpetra_BlockCrsMatrix> getBlockMatrix() const { return diagT; }
+
+    //! Invert the diagonal blocks
+    void compute();
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    //! Y = a*inv(D)*X + b*Y
+    virtual void apply(const Tpetra_MultiVector& X,
+                       Tpetra_MultiVector& Y,  Teuchos::ETransp mode = Teuchos::NO_TRANS,
+                       ST a = Teuchos::ScalarTraits<ST>::one(),
+                       ST b = Teuchos::ScalarTraits<ST>::zero()) const;
+
+    virtual bool hasTransposeApply() const { return true; }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const { return mapT; }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const { return mapT; }
+
+    //@}
+
+  private:
+
+    Teuchos::RCP<const Tpetra_CrsGraph> diagGraphT;
+    Teuchos::RCP<Tpetra_BlockCrsMatrix> diagT;
+    Teuchos::RCP<const Tpetra_Map> mapT;
+    int bs;
+
+    //! Inverted blocks, column-major, one per owned node
+    std::vector<ST> invBlocks;
+
+  }; // class BlockJacobiPrecOpT
+
+} // namespace Albany
+
+#endif // ALBANY_BLOCK_JACOBI_PREC_OP_T_HPP
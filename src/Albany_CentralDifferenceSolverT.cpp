@@ -0,0 +1,211 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_CentralDifferenceSolverT.hpp"
+
+#include <utility>
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+Albany::CentralDifferenceSolverT::
+CentralDifferenceSolverT(const Teuchos::RCP<Application>& app_,
+                         const Teuchos::RCP<Thyra::ModelEvaluator<ST> >& model_,
+                         const Teuchos::RCP<Teuchos::ParameterList>& piroParams,
+                         const Teuchos::RCP<Piro::ObserverBase<ST> >& observer_)
+  : app(app_),
+    model(model_),
+    observer(observer_),
+    out(Teuchos::VerboseObjectBase::getDefaultOStream())
+{
+  Teuchos::ParameterList& cdParams = piroParams->sublist("Central Difference");
+  cdParams.validateParametersAndSetDefaults(*getValidCentralDifferenceParameters());
+  initialTime = cdParams.get<double>("Initial Time");
+  finalTime = cdParams.get<double>("Final Time");
+  numTimeSteps = cdParams.get<int>("Num Time Steps");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(numTimeSteps < 1 || finalTime <= initialTime, std::logic_error,
+    "Error! Central Difference needs Num Time Steps > 0 and Final Time > Initial Time." << std::endl);
+
+  TEUCHOS_TEST_FOR_EXCEPTION(app->getAdaptSolMgrT()->getInitialSolution()->getNumVectors() < 3,
+    std::logic_error,
+    "Error! Central Difference needs displacement, velocity and acceleration: "
+    << "set Number Of Time Derivatives = 2 in the Discretization list." << std::endl);
+
+  sacado_param_vec.resize(model->Np());
+  for (int l = 0; l < model->Np(); ++l)
+    app->getParamLib()->fillVector<PHAL::AlbanyTraits::Residual>(
+      *model->get_p_names(l), sacado_param_vec[l]);
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::CentralDifferenceSolverT::
+getValidCentralDifferenceParameters()
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+    Teuchos::rcp(new Teuchos::ParameterList("Valid Central Difference Params"));
+  validPL->set<double>("Initial Time", 0.0, "Initial time");
+  validPL->set<double>("Final Time", 1.0, "Final time");
+  validPL->set<int>("Num Time Steps", 10, "Number of time steps, of size (Final Time - Initial Time)/Num Time Steps");
+  return validPL;
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::CentralDifferenceSolverT::
+getNominalValues() const
+{
+  Thyra::ModelEvaluatorBase::InArgs<ST> result = this->createInArgs();
+  const Thyra::ModelEvaluatorBase::InArgs<ST> modelNominalValues = model->getNominalValues();
+  for (int l = 0; l < model->Np(); ++l)
+    result.set_p(l, modelNominalValues.get_p(l));
+  return result;
+}
+
+Thyra::ModelEvaluatorBase::InArgs<ST>
+Albany::CentralDifferenceSolverT::
+createInArgs() const
+{
+  Thyra::ModelEvaluatorBase::InArgsSetup<ST> inArgs;
+  inArgs.setModelEvalDescription(this->description());
+  inArgs.set_Np(model->Np());
+  return inArgs;
+}
+
+Thyra::ModelEvaluatorBase::OutArgs<ST>
+Albany::CentralDifferenceSolverT::
+createOutArgsImpl() const
+{
+  // The final solution is the last response
+  Thyra::ModelEvaluatorBase::OutArgsSetup<ST> outArgs;
+  outArgs.setModelEvalDescription(this->description());
+  outArgs.set_Np_Ng(model->Np(), model->Ng() + 1);
+  return outArgs;
+}
+
+Teuchos::RCP<const Thyra::VectorSpaceBase<ST> >
+Albany::CentralDifferenceSolverT::
+get_p_space(int l) const
+{
+  return model->get_p_space(l);
+}
+
+Teuchos::RCP<const Thyra::VectorSpaceBase<ST> >
+Albany::CentralDifferenceSolverT::
+get_g_space(int j) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(j < 0 || j > model->Ng(), std::logic_error,
+    "Error! Central Difference has no response " << j << std::endl);
+  return (j < model->Ng()) ? model->get_g_space(j) : model->get_x_space();
+}
+
+void
+Albany::CentralDifferenceSolverT::
+observe(const Tpetra_Vector& x, const Tpetra_Vector& v, const double t) const
+{
+  if (Teuchos::is_null(observer)) return;
+
+  const Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > x_space = model->get_x_space();
+  observer->observeSolution(*Thyra::createConstVector(Teuchos::rcpFromRef(x), x_space),
+                            *Thyra::createConstVector(Teuchos::rcpFromRef(v), x_space), t);
+}
+
+void
+Albany::CentralDifferenceSolverT::
+evalModelImpl(const Thyra::ModelEvaluatorBase::InArgs<ST>& inArgs,
+              const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const
+{
+  for (int l = 0; l < inArgs.Np(); ++l) {
+    const Teuchos::RCP<const Thyra::VectorBase<ST> > p = inArgs.get_p(l);
+    if (Teuchos::nonnull(p)) {
+      const Teuchos::ArrayRCP<const ST> pT_constView = ConverterT::getConstTpetraVector(p)->get1dView();
+      for (unsigned int k = 0; k < sacado_param_vec[l].size(); ++k)
+        sacado_param_vec[l][k].baseValue = pT_constView[k];
+    }
+  }
+
+  const Teuchos::RCP<const Tpetra_MultiVector> initialSolution =
+    app->getAdaptSolMgrT()->getInitialSolution();
+  const Teuchos::RCP<const Tpetra_Map> mapT = initialSolution->getMap();
+
+  // x, v hold x_n and v_{n-1/2}; xNext receives x_{n+1}
+  Teuchos::RCP<Tpetra_Vector> x = Teuchos::rcp(new Tpetra_Vector(*initialSolution->getVector(0)));
+  Teuchos::RCP<Tpetra_Vector> xNext = Teuchos::rcp(new Tpetra_Vector(mapT));
+  Tpetra_Vector v(*initialSolution->getVector(1));
+  Tpetra_Vector vNow(mapT), a(mapT), r(mapT), mass(mapT), dbc(mapT);
+  const Tpetra_Vector zero(mapT, true);
+
+  const double dt = (finalTime - initialTime)/numTimeSteps;
+  double t = initialTime;
+
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("Albany: Central Difference Lumped Mass");
+    app->computeLumpedMassT(t, &v, &zero, *x, sacado_param_vec, mass);
+    app->computeDirichletRowsT(t, &v, &zero, *x, dbc);
+  }
+
+  *out << "Central Difference: " << numTimeSteps << " steps of size " << dt << std::endl;
+
+  const Teuchos::ArrayRCP<const ST> m = mass.get1dView();
+  const Teuchos::ArrayRCP<const ST> isDBC = dbc.get1dView();
+  const std::size_t numDOFs = mapT->getNodeNumElements();
+
+  for (std::size_t i = 0; i < numDOFs; ++i)
+    TEUCHOS_TEST_FOR_EXCEPTION(isDBC[i] == 0.0 && !(m[i] > 0.0), std::logic_error,
+      "Error! Central Difference needs a positive lumped mass, but DOF "
+      << mapT->getGlobalElement(i) << " has " << m[i] << std::endl);
+
+  for (int n = 0; n <= numTimeSteps; ++n) {
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("Albany: Central Difference Residual");
+      app->computeGlobalResidualT(t, &v, &zero, *x, sacado_param_vec, r);
+    }
+
+    // The first step starts from v_0 rather than v_{-1/2}
+    const double dtBefore = (n == 0) ? 0.0 : 0.5*dt;
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("Albany: Central Difference Update");
+      const Teuchos::ArrayRCP<const ST> rView = r.get1dView();
+      const Teuchos::ArrayRCP<ST> xView = x->get1dViewNonConst();
+      const Teuchos::ArrayRCP<ST> xNextView = xNext->get1dViewNonConst();
+      const Teuchos::ArrayRCP<ST> vView = v.get1dViewNonConst();
+      const Teuchos::ArrayRCP<ST> vNowView = vNow.get1dViewNonConst();
+      const Teuchos::ArrayRCP<ST> aView = a.get1dViewNonConst();
+      for (std::size_t i = 0; i < numDOFs; ++i) {
+        if (isDBC[i] != 0.0) {
+          xView[i] -= rView[i];
+          xNextView[i] = xView[i];
+          vNowView[i] = vView[i] = aView[i] = 0.0;
+        }
+        else {
+          aView[i] = -rView[i]/m[i];
+          vNowView[i] = vView[i] + dtBefore*aView[i];
+          vView[i] = vNowView[i] + 0.5*dt*aView[i];
+          xNextView[i] = xView[i] + dt*vView[i];
+        }
+      }
+    }
+
+    observe(*x, vNow, t);
+
+    if (n < numTimeSteps) {
+      std::swap(x, xNext);
+      t = initialTime + (n + 1)*dt;
+    }
+  }
+
+  // Responses at the final state
+  for (int j = 0; j < model->Ng(); ++j) {
+    const Teuchos::RCP<Thyra::VectorBase<ST> > g = outArgs.get_g(j);
+    if (Teuchos::nonnull(g))
+      app->evaluateResponseT(j, t, &vNow, &a, *x, sacado_param_vec,
+                             *ConverterT::getTpetraVector(g));
+  }
+
+  const Teuchos::RCP<Thyra::VectorBase<ST> > gx = outArgs.get_g(model->Ng());
+  if (Teuchos::nonnull(gx))
+    ConverterT::getTpetraVector(gx)->update(1.0, *x, 0.0);
+}
@@ -0,0 +1,87 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_CENTRAL_DIFFERENCE_SOLVER_T_HPP
+#define ALBANY_CENTRAL_DIFFERENCE_SOLVER_T_HPP
+
+#include "Albany_Application.hpp"
+#include "Albany_DataTypes.hpp"
+
+#include "Piro_ObserverBase.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+
+namespace Albany {
+
+  //! Explicit central difference time integration with a lumped mass
+  /*!
+   * Integrates f(x, v, a, t) = M a + r(x, v, t) = 0 with M replaced by its
+   * row sums m. The row sums are computed once, by a Tangent fill in the
+   * direction a = 1, so neither a Jacobian graph nor a matrix is formed.
+   * Each step is one residual fill with a = 0, followed by a single pass over
+   * the owned DOFs that updates acceleration, velocity and displacement:
+   *   a_n       = -r(x_n, v_{n-1/2}, t_n) / m
+   *   v_n       = v_{n-1/2} + dt/2 a_n
+   *   v_{n+1/2} = v_n + dt/2 a_n
+   *   x_{n+1}   = x_n + dt v_{n+1/2}
+   * The Dirichlet DOFs, found once from the Dirichlet field manager, have
+   * residual x - g(t); they are set to g(t_n) and held at rest during the
+   * step. Every other DOF needs a positive lumped mass.
+   *
+   * Selected with "Second Order" = "Central Difference" in the Problem list;
+   * the Piro "Central Difference" sublist sets the time stepping. The
+   * responses are evaluated at the final time, and the final solution is
+   * returned as the last response, as the Piro solvers do.
+   */
+  class CentralDifferenceSolverT : public Thyra::ResponseOnlyModelEvaluatorBase<ST> {
+  public:
+
+    CentralDifferenceSolverT(const Teuchos::RCP<Application>& app,
+                             const Teuchos::RCP<Thyra::ModelEvaluator<ST> >& model,
+                             const Teuchos::RCP<Teuchos::ParameterList>& piroParams,
+                             const Teuchos::RCP<Piro::ObserverBase<ST> >& observer = Teuchos::null);
+
+    //! @name Thyra::ModelEvaluator methods
+    //@{
+
+    Thyra::ModelEvaluatorBase::InArgs<ST> getNominalValues() const;
+
+    Thyra::ModelEvaluatorBase::InArgs<ST> createInArgs() const;
+
+    Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > get_p_space(int l) const;
+
+    Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > get_g_space(int j) const;
+
+    //@}
+
+    static Teuchos::RCP<const Teuchos::ParameterList> getValidCentralDifferenceParameters();
+
+  private:
+
+    Thyra::ModelEvaluatorBase::OutArgs<ST> createOutArgsImpl() const;
+
+    void evalModelImpl(const Thyra::ModelEvaluatorBase::InArgs<ST>& inArgs,
+                       const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const;
+
+    void observe(const Tpetra_Vector& x, const Tpetra_Vector& v, const double t) const;
+
+    Teuchos::RCP<Application> app;
+    Teuchos::RCP<Thyra::ModelEvaluator<ST> > model;
+    Teuchos::RCP<Piro::ObserverBase<ST> > observer;
+    Teuchos::RCP<Teuchos::FancyOStream> out;
+
+    double initialTime, finalTime;
+    int numTimeSteps;
+
+    //! Parameters handed to the fills, as in ModelEvaluatorT
+    mutable Teuchos::Array<ParamVec> sacado_param_vec;
+
+  }; // class CentralDifferenceSolverT
+
+} // namespace Albany
+
+#endif // ALBANY_CENTRAL_DIFFERENCE_SOLVER_T_HPP
@@ -24,6 +24,7 @@
 #include "Sacado_ELRCacheFad_DFad.hpp"
 #include "Sacado_Fad_DFad.hpp"
 #include "Sacado_Fad_SLFad.hpp"
+#include "Sacado_Fad_SFad.hpp"
 #include "Sacado_ELRFad_SLFad.hpp"
 #include "Sacado_ELRFad_SFad.hpp"
 #include "Sacado_CacheFad_DFad.hpp"
@@ -38,8 +39,8 @@
 #endif
 
 //amb Need to move to configuration.
-//#define ALBANY_SFAD_SIZE 27
 //#define ALBANY_SLFAD_SIZE 27
+// ALBANY_SFAD_SIZE is set by the SFAD_ELEMENT configure option
 
 //#define ALBANY_ENSEMBLE_SIZE 32  -- set in CMakeLists.txt
 
@@ -68,8 +69,16 @@ typedef Sacado::MP::Vector<MPStorageType> MPType;
   typedef Sacado::Fad::SLFad<RealType, ALBANY_SLFAD_SIZE> FadType;
   typedef Sacado::Fad::SLFad<SGType, ALBANY_SLFAD_SIZE> SGFadType;
   typedef Sacado::Fad::SLFad<MPType, ALBANY_SLFAD_SIZE> MPFadType;
+#elif defined(ALBANY_SFAD_SIZE)
+  // Fully static derivative arrays: every Jacobian field manager must have
+  // exactly ALBANY_SFAD_SIZE element DOFs, which Albany::Application checks
+#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
+  typedef Sacado::Fad::SFad<RealType, ALBANY_SFAD_SIZE> FadType;
+#ifdef ALBANY_STOKHOS
+  typedef Sacado::Fad::SLFad<SGType, ALBANY_SFAD_SIZE> SGFadType;
+  typedef Sacado::Fad::SLFad<MPType, ALBANY_SFAD_SIZE> MPFadType;
+#endif
 #else
-#define ALBANY_SFAD_SIZE 300
   typedef Sacado::Fad::DFad<RealType> FadType;
 #ifdef ALBANY_STOKHOS
   typedef Sacado::Fad::DFad<SGType> SGFadType;
@@ -86,6 +95,7 @@ typedef Sacado::Fad::DFad<RealType> TanFadType;
 #include "Tpetra_Map.hpp"
 #include "Tpetra_CrsGraph.hpp"
 #include "Tpetra_CrsMatrix.hpp"
+#include "Tpetra_Experimental_BlockCrsMatrix.hpp"
 #include "Tpetra_DistObject.hpp"
 #include "Tpetra_Operator.hpp"
 #include "Tpetra_MultiVector.hpp"
@@ -114,6 +124,7 @@ typedef Tpetra::Import<LO, GO, KokkosNode>          Tpetra_Import;
 typedef Tpetra::CrsGraph<LO, GO, KokkosNode>        Tpetra_CrsGraph;
 typedef Tpetra::CrsMatrix<ST, LO, GO, KokkosNode>   Tpetra_CrsMatrix;
 typedef Tpetra::RowMatrix<ST, LO, GO, KokkosNode>   Tpetra_RowMatrix;
+typedef Tpetra::Experimental::BlockCrsMatrix<ST, LO, GO, KokkosNode> Tpetra_BlockCrsMatrix;
 typedef Tpetra::Operator<ST, LO, GO, KokkosNode>    Tpetra_Operator;
 typedef Tpetra::Vector<ST, LO, GO, KokkosNode>      Tpetra_Vector;
 typedef Tpetra::MultiVector<ST, LO, GO, KokkosNode> Tpetra_MultiVector;
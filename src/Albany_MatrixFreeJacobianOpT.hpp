@@ -0,0 +1,134 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+#define ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Albany_Application.hpp"
+
+namespace Albany {
+
+  //! Tpetra_Operator implementing the action of the Jacobian W without storing it
+  /*!
+   * W*v = alpha*df/dxdot*v + beta*df/dx*v + omega*df/dxdotdot*v is computed
+   * with one Tangent fill per column of v, seeded in the direction v. The
+   * derivatives are exact, unlike finite-difference Jacobian-free Newton-Krylov.
+   */
+  class MatrixFreeJacobianOpT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    MatrixFreeJacobianOpT(const Teuchos::RCP<Application>& app_) :
+      app(app_), alpha(0.0), beta(1.0), omega(0.0), time(0.0) {}
+
+    //! Destructor
+    virtual ~MatrixFreeJacobianOpT() {}
+
+    //! Set the point W is linearized about; the vectors are copied
+    void set(const double alpha_,
+             const double beta_,
+             const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdotdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& x_,
+             const Teuchos::Array<ParamVec>& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      x = copy(x_);
+      xdot = copy(xdot_);
+      xdotdot = copy(xdotdot_);
+      scalar_params = scalar_params_;
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    //! Y = a*W*X + b*Y
+    virtual void apply(const Tpetra_MultiVector& X,
+                       Tpetra_MultiVector& Y,  Teuchos::ETransp mode = Teuchos::NO_TRANS,
+                       ST a = Teuchos::ScalarTraits<ST>::one(),
+                       ST b = Teuchos::ScalarTraits<ST>::zero()) const {
+      TEUCHOS_TEST_FOR_EXCEPTION(mode != Teuchos::NO_TRANS, std::logic_error,
+        "MatrixFreeJacobianOpT: transpose apply is not supported." << std::endl);
+      TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(x), std::logic_error,
+        "MatrixFreeJacobianOpT: apply() called before set()." << std::endl);
+
+      // The Tangent fill overwrites its output, so accumulate through a copy
+      const bool accumulate = (a != Teuchos::ScalarTraits<ST>::one() ||
+                               b != Teuchos::ScalarTraits<ST>::zero());
+      Teuchos::RCP<Tpetra_MultiVector> WX = Teuchos::rcpFromRef(Y);
+      if (accumulate)
+        WX = Teuchos::rcp(new Tpetra_MultiVector(Y.getMap(), Y.getNumVectors()));
+
+      app->computeGlobalTangentT(
+          alpha, beta, omega, time, false, xdot.get(), xdotdot.get(), *x,
+          scalar_params, NULL,
+          &X, Teuchos::nonnull(xdot) ? &X : NULL, Teuchos::nonnull(xdotdot) ? &X : NULL,
+          NULL, NULL, WX.get(), NULL);
+
+      if (accumulate)
+        Y.update(a, *WX, b);
+    }
+
+    virtual bool hasTransposeApply() const { return false; }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return app->getMapT();
+    }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return app->getMapT();
+    }
+
+    //@}
+
+  protected:
+
+    static Teuchos::RCP<const Tpetra_Vector>
+    copy(const Teuchos::RCP<const Tpetra_Vector>& v) {
+      if (Teuchos::is_null(v)) return Teuchos::null;
+      return Teuchos::rcp(new Tpetra_Vector(*v, Teuchos::Copy));
+    }
+
+    //! Albany application
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot
+    double alpha, beta, omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<const Tpetra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<const Tpetra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<const Tpetra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::Array<ParamVec> scalar_params;
+
+    //@}
+
+  }; // class MatrixFreeJacobianOpT
+
+} // namespace Albany
+
+#endif // ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
@@ -8,6 +8,9 @@
 
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DistributedParameterDerivativeOpT.hpp"
+#include "Albany_MatrixFreeJacobianOpT.hpp"
+#include "Albany_BlockJacobiPrecOpT.hpp"
+#include "Thyra_DefaultPreconditioner.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
@@ -85,6 +88,18 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
       << l << " = " << numParameters << std::endl;
   }
 
+  matrixFreeJacobian = problemParams.get("Matrix-Free Jacobian", false);
+  matrixFreePrecType =
+    problemParams.get<std::string>("Matrix-Free Preconditioner", "None");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    matrixFreePrecType != "None" && matrixFreePrecType != "Block Jacobi",
+    Teuchos::Exceptions::InvalidParameter,
+    std::endl << "Error!  In Albany::ModelEvaluatorT constructor:  " <<
+    "Unknown Matrix-Free Preconditioner " << matrixFreePrecType <<
+    ". Valid choices are None and Block Jacobi." << std::endl);
+  if (matrixFreeJacobian)
+    *out << "Matrix-free Jacobian, preconditioner = " << matrixFreePrecType << std::endl;
+
   // Setup distributed parameters
   distParamLib = app->getDistParamLib();
   Teuchos::ParameterList& distParameterParams =
@@ -345,6 +360,21 @@ Albany::ModelEvaluatorT::getUpperBounds() const
 Teuchos::RCP<Thyra::LinearOpBase<ST> >
 Albany::ModelEvaluatorT::create_W_op() const
 {
+  // Matrix-free: only the linearization point is stored
+  if (matrixFreeJacobian) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+      Teuchos::rcp(new Albany::MatrixFreeJacobianOpT(app));
+    return Thyra::createLinearOp(W);
+  }
+
+  // Block CRS storage: one neq x neq block per node pair
+  const Teuchos::RCP<const Tpetra_CrsGraph> nodeGraphT = app->getNodeJacobianGraphT();
+  if (Teuchos::nonnull(nodeGraphT)) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+      Teuchos::rcp(new Tpetra_BlockCrsMatrix(*nodeGraphT, app->getNumEquations()));
+    return Thyra::createLinearOp(W);
+  }
+
   const Teuchos::RCP<Tpetra_Operator> W =
     Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -354,6 +384,13 @@ Albany::ModelEvaluatorT::create_W_op() const
 Teuchos::RCP<Thyra::PreconditionerBase<ST> >
 Albany::ModelEvaluatorT::create_W_prec() const
 {
+  if (matrixFreeJacobian && matrixFreePrecType == "Block Jacobi") {
+    const Teuchos::RCP<Tpetra_Operator> precOp =
+      Teuchos::rcp(new Albany::BlockJacobiPrecOpT(
+        app->getNodeBlockDiagonalGraphT(), app->getNumEquations(), app->getMapT()));
+    return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>(Thyra::createLinearOp(precOp)));
+  }
+
   // TODO: Analog of EpetraExt::ModelEvaluator::Preconditioner does not exist in Thyra yet!
   const bool W_prec_not_supported = true;
   TEUCHOS_TEST_FOR_EXCEPT(W_prec_not_supported);
@@ -464,6 +501,8 @@ Albany::ModelEvaluatorT::createOutArgsImpl() const
         Thyra::ModelEvaluatorBase::DERIV_LINEARITY_UNKNOWN,
         Thyra::ModelEvaluatorBase::DERIV_RANK_FULL,
         true));
+  if (matrixFreeJacobian && matrixFreePrecType != "None")
+    result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec, true);
 
   for (int l = 0; l < num_param_vecs; ++l) {
     result.setSupports(
@@ -606,9 +645,20 @@ Albany::ModelEvaluatorT::evalModelImpl(
     Teuchos::null;
 #endif
 
-  // Cast W to a CrsMatrix, throw an exception if this fails
+  const Teuchos::RCP<Thyra::PreconditionerBase<ST> > W_prec_out =
+    outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) ?
+    outArgsT.get_W_prec() :
+    Teuchos::null;
+
+  // Cast W to a matrix-free operator, a BlockCrsMatrix (Block CRS storage)
+  // or else to a CrsMatrix, throw an exception if this fails
+  const Teuchos::RCP<Albany::MatrixFreeJacobianOpT> W_op_out_mfT =
+    Teuchos::rcp_dynamic_cast<Albany::MatrixFreeJacobianOpT>(W_op_outT);
+  const Teuchos::RCP<Tpetra_BlockCrsMatrix> W_op_out_blockT =
+    Teuchos::rcp_dynamic_cast<Tpetra_BlockCrsMatrix>(W_op_outT);
   const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
-    Teuchos::nonnull(W_op_outT) ?
+    Teuchos::nonnull(W_op_outT) && Teuchos::is_null(W_op_out_blockT) &&
+    Teuchos::is_null(W_op_out_mfT) ?
     Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true) :
     Teuchos::null;
 
@@ -643,6 +693,30 @@ Albany::ModelEvaluatorT::evalModelImpl(
     Tpetra_MatrixMarket_Writer::writeMapFile("colmap.mm", *Mass_crs->getColMap());
 #endif
   }
+  else if (Teuchos::nonnull(W_op_out_blockT)) {
+    app->computeGlobalBlockJacobianT(
+        alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(),  *xT,
+        sacado_param_vec, fT_out.get(), *W_op_out_blockT);
+    f_already_computed = true;
+  }
+  else if (Teuchos::nonnull(W_op_out_mfT)) {
+    W_op_out_mfT->set(alpha, beta, omega, curr_time, x_dotT, x_dotdotT, xT,
+                      sacado_param_vec);
+  }
+
+  // Preconditioner for the matrix-free W
+  if (Teuchos::nonnull(W_prec_out)) {
+    const Teuchos::RCP<Albany::BlockJacobiPrecOpT> W_prec_outT =
+      Teuchos::rcp_dynamic_cast<Albany::BlockJacobiPrecOpT>(
+        ConverterT::getTpetraOperator(W_prec_out->getNonconstUnspecifiedPrecOp()), true);
+    W_prec_outT->setGraph(app->getNodeBlockDiagonalGraphT(), app->getMapT());
+    app->computeGlobalBlockDiagonalJacobianT(
+        alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(),  *xT,
+        sacado_param_vec, f_already_computed ? NULL : fT_out.get(),
+        *W_prec_outT->getBlockMatrix());
+    W_prec_outT->compute();
+    f_already_computed = true;
+  }
 
   // df/dp
   for (int l = 0; l < outArgsT.Np(); ++l) {
@@ -144,6 +144,12 @@ private:
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
 
+  //! W is applied through Tangent fills instead of being assembled
+  bool matrixFreeJacobian;
+
+  //! Preconditioner assembled for the matrix-free Jacobian: None or Block Jacobi
+  std::string matrixFreePrecType;
+
 };
 
 }
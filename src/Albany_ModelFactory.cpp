@@ -48,6 +48,12 @@ RCP<EpetraExt::ModelEvaluator> ModelFactory::create() const
     // Wrap a decorator around the original model when a reduced-order computation is requested.
     const RCP<MOR::ReducedOrderModelFactory> romFactory = app_->getMorFacade()->modelFactory();
     model = romFactory->create(model);
+
+    // With a sample mesh, only the worksets the collocation projection reads are filled.
+    const RCP<const Teuchos::Array<int> > sampleDofs = romFactory->getSampleMeshDofs();
+    if (Teuchos::nonnull(sampleDofs)) {
+      app_->setSampleDofs(*sampleDofs);
+    }
   }
 #endif
 
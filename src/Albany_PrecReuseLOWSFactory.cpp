@@ -0,0 +1,373 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_PrecReuseLOWSFactory.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "Teuchos_TestForException.hpp"
+#include "Thyra_LinearOpWithSolveBase.hpp"
+
+namespace {
+
+// Forwards to the wrapped solver and records how the solves went, for the
+// factory to decide when the preconditioner has gone stale.
+class ReusingLOWS : public Thyra::LinearOpWithSolveBase<ST> {
+public:
+
+  ReusingLOWS(const Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST> >& lows_,
+              const double rebuildIterationRatio_)
+    : lows(lows_), rebuildIterationRatio(rebuildIterationRatio_),
+      numInitializations(0), firstIterations(-1), stale(false) {}
+
+  // Called by the factory each time the preconditioner is recomputed
+  void resetHistory() {
+    numInitializations = 0;
+    firstIterations = -1;
+    stale = false;
+  }
+
+  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST> > lows;
+  double rebuildIterationRatio;
+
+  //! Weak, so that a new operator at the address of a freed one is detected
+  Teuchos::RCP<const Thyra::LinearOpBase<ST> > fwdOp;
+
+  //! Jacobians seen since the preconditioner was recomputed
+  int numInitializations;
+
+  //! Iterations of the first solve with the current preconditioner
+  mutable int firstIterations;
+
+  //! A solve failed or slowed down too much
+  mutable bool stale;
+
+  virtual Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > range() const { return lows->range(); }
+
+  virtual Teuchos::RCP<const Thyra::VectorSpaceBase<ST> > domain() const { return lows->domain(); }
+
+  virtual std::string description() const {
+    return "Albany::PrecReuseLOWSFactory{" + lows->description() + "}";
+  }
+
+protected:
+
+  virtual bool opSupportedImpl(Thyra::EOpTransp M_trans) const { return lows->opSupported(M_trans); }
+
+  virtual void applyImpl(const Thyra::EOpTransp M_trans,
+                         const Thyra::MultiVectorBase<ST>& X,
+                         const Teuchos::Ptr<Thyra::MultiVectorBase<ST> >& Y,
+                         const ST alpha, const ST beta) const {
+    lows->apply(M_trans, X, Y, alpha, beta);
+  }
+
+  virtual bool solveSupportsImpl(Thyra::EOpTransp transp) const { return lows->solveSupports(transp); }
+
+  virtual bool solveSupportsSolveMeasureTypeImpl(Thyra::EOpTransp transp,
+                                                 const Thyra::SolveMeasureType& solveMeasureType) const {
+    return lows->solveSupportsSolveMeasureType(transp, solveMeasureType);
+  }
+
+  virtual Thyra::SolveStatus<ST> solveImpl(const Thyra::EOpTransp transp,
+                                           const Thyra::MultiVectorBase<ST>& B,
+                                           const Teuchos::Ptr<Thyra::MultiVectorBase<ST> >& X,
+                                           const Teuchos::Ptr<const Thyra::SolveCriteria<ST> > solveCriteria) const {
+    const Thyra::SolveStatus<ST> status = lows->solve(transp, B, X, solveCriteria);
+
+    if (status.solveStatus == Thyra::SOLVE_STATUS_UNCONVERGED)
+      stale = true;
+
+    // Belos and AztecOO report their iteration count here
+    if (Teuchos::nonnull(status.extraParameters) &&
+        status.extraParameters->isType<int>("Iteration Count")) {
+      const int iterations = status.extraParameters->get<int>("Iteration Count");
+      if (firstIterations < 0)
+        firstIterations = iterations;
+      else if (rebuildIterationRatio > 0.0 &&
+               iterations > rebuildIterationRatio*std::max(firstIterations, 1))
+        stale = true;
+    }
+    return status;
+  }
+};
+
+ReusingLOWS& getReusingLOWS(Thyra::LinearOpWithSolveBase<ST>* Op)
+{
+  ReusingLOWS* reusing = dynamic_cast<ReusingLOWS*>(Op);
+  TEUCHOS_TEST_FOR_EXCEPTION(reusing == NULL, std::logic_error,
+    "Error! PrecReuseLOWSFactory was given an operator it did not create." << std::endl);
+  return *reusing;
+}
+
+} // namespace
+
+Albany::PrecReuseLOWSFactory::
+PrecReuseLOWSFactory(const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >& lowsFactory_,
+                     const int reuseInterval_,
+                     const double rebuildIterationRatio_,
+                     const Teuchos::RCP<Teuchos::ParameterList>& statsParams_)
+  : lowsFactory(lowsFactory_),
+    reuseInterval(std::max(reuseInterval_, 1)),
+    rebuildIterationRatio(rebuildIterationRatio_),
+    statsParams(statsParams_),
+    numJacobians(0),
+    numPrecComputations(0)
+{
+}
+
+Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >
+Albany::PrecReuseLOWSFactory::
+create(const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >& lowsFactory,
+       const Teuchos::RCP<Teuchos::ParameterList>& piroParams)
+{
+  if (!piroParams->isSublist("Preconditioner Reuse"))
+    return lowsFactory;
+
+  const Teuchos::RCP<Teuchos::ParameterList> reuseParams =
+    Teuchos::sublist(piroParams, "Preconditioner Reuse");
+  reuseParams->validateParametersAndSetDefaults(*getValidReuseParameters());
+  return Teuchos::rcp(new PrecReuseLOWSFactory(lowsFactory,
+                                               reuseParams->get<int>("Reuse Interval"),
+                                               reuseParams->get<double>("Rebuild Iteration Ratio"),
+                                               reuseParams));
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+setMueLuReuse(const Teuchos::RCP<Teuchos::ParameterList>& piroParams,
+              const Teuchos::RCP<Teuchos::ParameterList>& stratList)
+{
+  if (stratList.is_null() || !piroParams->isSublist("Preconditioner Reuse"))
+    return;
+  if (!piroParams->sublist("Preconditioner Reuse").get("Keep MueLu Aggregates", false))
+    return;
+  if (!stratList->isType<std::string>("Preconditioner Type"))
+    return;
+
+  const std::string precType = stratList->get<std::string>("Preconditioner Type");
+  if (precType != "MueLu" && precType != "MueLu-Tpetra")
+    return;
+
+  // Keep the prolongator and restriction, recompute only the coarse operators
+  Teuchos::ParameterList& mueluParams = stratList->sublist("Preconditioner Types").sublist(precType);
+  if (!mueluParams.isParameter("reuse: type"))
+    mueluParams.set("reuse: type", "RP");
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::PrecReuseLOWSFactory::
+getValidReuseParameters()
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+    Teuchos::rcp(new Teuchos::ParameterList("Valid Preconditioner Reuse Params"));
+  validPL->set<int>("Reuse Interval", 1,
+    "Number of Jacobians that share one preconditioner computation (1 recomputes it for every Jacobian)");
+  validPL->set<double>("Rebuild Iteration Ratio", 2.0,
+    "Rebuild the preconditioner once a solve takes more than this times the iterations of the first solve with it (0 disables)");
+  validPL->set<bool>("Keep MueLu Aggregates", false,
+    "Keep the MueLu aggregates and transfer operators when the preconditioner is recomputed");
+  validPL->set<int>("Number of Jacobians", 0,
+    "Output: number of Jacobians handed to the linear solver");
+  validPL->set<int>("Number of Preconditioner Computations", 0,
+    "Output: number of times the preconditioner was computed");
+  return validPL;
+}
+
+bool
+Albany::PrecReuseLOWSFactory::
+isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+  return lowsFactory->isCompatible(fwdOpSrc);
+}
+
+bool
+Albany::PrecReuseLOWSFactory::
+acceptsPreconditionerFactory() const
+{
+  return lowsFactory->acceptsPreconditionerFactory();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+setPreconditionerFactory(const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> >& precFactory,
+                         const std::string& precFactoryName)
+{
+  lowsFactory->setPreconditionerFactory(precFactory, precFactoryName);
+}
+
+Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> >
+Albany::PrecReuseLOWSFactory::
+getPreconditionerFactory() const
+{
+  return lowsFactory->getPreconditionerFactory();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+unsetPreconditionerFactory(Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> >* precFactory,
+                           std::string* precFactoryName)
+{
+  lowsFactory->unsetPreconditionerFactory(precFactory, precFactoryName);
+}
+
+bool
+Albany::PrecReuseLOWSFactory::
+supportsPreconditionerInputType(const Thyra::EPreconditionerInputType precOpType) const
+{
+  return lowsFactory->supportsPreconditionerInputType(precOpType);
+}
+
+Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST> >
+Albany::PrecReuseLOWSFactory::
+createOp() const
+{
+  return Teuchos::rcp(new ReusingLOWS(lowsFactory->createOp(), rebuildIterationRatio));
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+initializeOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+             Thyra::LinearOpWithSolveBase<ST>* Op,
+             const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  ReusingLOWS& reusing = getReusingLOWS(Op);
+  const Teuchos::RCP<const Thyra::LinearOpBase<ST> > fwdOp = fwdOpSrc->getOp();
+
+  const bool sameOp = reusing.fwdOp.is_valid_ptr() && reusing.fwdOp.get() == fwdOp.get();
+
+  if (!sameOp || reusing.stale) {
+    // Start over, dropping whatever the old preconditioner kept for reuse
+    if (Teuchos::nonnull(reusing.fwdOp))
+      reusing.lows = lowsFactory->createOp();
+    lowsFactory->initializeOp(fwdOpSrc, reusing.lows.get(), supportSolveUse);
+    reusing.resetHistory();
+    recordInitialization(true);
+  }
+  else if (reusing.numInitializations + 1 >= reuseInterval) {
+    lowsFactory->initializeOp(fwdOpSrc, reusing.lows.get(), supportSolveUse);
+    reusing.resetHistory();
+    recordInitialization(true);
+  }
+  else {
+    lowsFactory->initializeAndReuseOp(fwdOpSrc, reusing.lows.get());
+    ++reusing.numInitializations;
+    recordInitialization(false);
+  }
+
+  reusing.fwdOp = fwdOp.create_weak();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+initializeAndReuseOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                     Thyra::LinearOpWithSolveBase<ST>* Op) const
+{
+  ReusingLOWS& reusing = getReusingLOWS(Op);
+  lowsFactory->initializeAndReuseOp(fwdOpSrc, reusing.lows.get());
+  reusing.fwdOp = fwdOpSrc->getOp().create_weak();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+initializePreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                           const Teuchos::RCP<const Thyra::PreconditionerBase<ST> >& prec,
+                           Thyra::LinearOpWithSolveBase<ST>* Op,
+                           const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  // The caller owns the preconditioner, there is nothing to reuse here
+  ReusingLOWS& reusing = getReusingLOWS(Op);
+  lowsFactory->initializePreconditionedOp(fwdOpSrc, prec, reusing.lows.get(), supportSolveUse);
+  reusing.resetHistory();
+  reusing.fwdOp = fwdOpSrc->getOp().create_weak();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+initializeApproxPreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                                 const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& approxFwdOpSrc,
+                                 Thyra::LinearOpWithSolveBase<ST>* Op,
+                                 const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  ReusingLOWS& reusing = getReusingLOWS(Op);
+  lowsFactory->initializeApproxPreconditionedOp(fwdOpSrc, approxFwdOpSrc, reusing.lows.get(),
+                                                supportSolveUse);
+  reusing.resetHistory();
+  reusing.fwdOp = fwdOpSrc->getOp().create_weak();
+  recordInitialization(true);
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+uninitializeOp(Thyra::LinearOpWithSolveBase<ST>* Op,
+               Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* fwdOpSrc,
+               Teuchos::RCP<const Thyra::PreconditionerBase<ST> >* prec,
+               Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* approxFwdOpSrc,
+               Thyra::ESupportSolveUse* supportSolveUse) const
+{
+  // The wrapped factory holds on to its own preconditioner for reuse, and
+  // the reuse history stays with the operator.
+  lowsFactory->uninitializeOp(getReusingLOWS(Op).lows.get(), fwdOpSrc, prec,
+                              approxFwdOpSrc, supportSolveUse);
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+{
+  lowsFactory->setParameterList(paramList);
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::PrecReuseLOWSFactory::
+getNonconstParameterList()
+{
+  return lowsFactory->getNonconstParameterList();
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::PrecReuseLOWSFactory::
+unsetParameterList()
+{
+  return lowsFactory->unsetParameterList();
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::PrecReuseLOWSFactory::
+getParameterList() const
+{
+  return lowsFactory->getParameterList();
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::PrecReuseLOWSFactory::
+getValidParameters() const
+{
+  return lowsFactory->getValidParameters();
+}
+
+void
+Albany::PrecReuseLOWSFactory::
+recordInitialization(const bool recomputed) const
+{
+  ++numJacobians;
+  if (recomputed) ++numPrecComputations;
+  if (Teuchos::nonnull(statsParams)) {
+    statsParams->set("Number of Jacobians", numJacobians);
+    statsParams->set("Number of Preconditioner Computations", numPrecComputations);
+  }
+}
+
+std::string
+Albany::PrecReuseLOWSFactory::
+description() const
+{
+  std::ostringstream oss;
+  oss << "Albany::PrecReuseLOWSFactory{reuseInterval=" << reuseInterval
+      << ", rebuildIterationRatio=" << rebuildIterationRatio
+      << ", " << lowsFactory->description() << "}";
+  return oss.str();
+}
@@ -0,0 +1,131 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_PREC_REUSE_LOWS_FACTORY_HPP
+#define ALBANY_PREC_REUSE_LOWS_FACTORY_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Thyra_LinearOpWithSolveFactoryBase.hpp"
+
+namespace Albany {
+
+  //! Linear solver factory that keeps the preconditioner across Jacobians
+  /*!
+   * Wraps a Stratimikos linear solver factory. Each time the model hands a
+   * new Jacobian to the solver, the wrapped factory is asked either to reuse
+   * the preconditioner (and the symbolic factorization of direct solvers)
+   * built for an earlier Jacobian, through initializeAndReuseOp, or to
+   * recompute it, through initializeOp. The preconditioner is recomputed
+   *  - once every "Reuse Interval" Jacobians. Setup data that the
+   *    preconditioner keeps by itself, such as MueLu aggregates and
+   *    prolongators with "reuse: type", survive this numeric refresh;
+   *  - from scratch, after a solve that did not converge or that took more
+   *    than "Rebuild Iteration Ratio" times the iterations of the first
+   *    solve with the current preconditioner, and when the Jacobian
+   *    operator itself changes, e.g. after remeshing.
+   * A preconditioner factory, or a preconditioner supplied by the caller,
+   * is handed through to the wrapped factory. The number of Jacobians and of
+   * preconditioner computations is recorded in statsParams, if given.
+   */
+  class PrecReuseLOWSFactory : public Thyra::LinearOpWithSolveFactoryBase<ST> {
+  public:
+
+    PrecReuseLOWSFactory(const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >& lowsFactory,
+                         const int reuseInterval,
+                         const double rebuildIterationRatio,
+                         const Teuchos::RCP<Teuchos::ParameterList>& statsParams = Teuchos::null);
+
+    //! Wrap lowsFactory as requested by the "Preconditioner Reuse" sublist of
+    //! piroParams; returns lowsFactory itself when there is no such sublist.
+    static Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >
+    create(const Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> >& lowsFactory,
+           const Teuchos::RCP<Teuchos::ParameterList>& piroParams);
+
+    //! Ask MueLu to keep its aggregates and transfer operators when the
+    //! preconditioner is recomputed, if "Keep MueLu Aggregates" is set.
+    //! Must be called before the Stratimikos builder reads stratList.
+    static void setMueLuReuse(const Teuchos::RCP<Teuchos::ParameterList>& piroParams,
+                              const Teuchos::RCP<Teuchos::ParameterList>& stratList);
+
+    static Teuchos::RCP<const Teuchos::ParameterList> getValidReuseParameters();
+
+    //! @name Thyra::LinearOpWithSolveFactoryBase methods
+    //@{
+
+    virtual bool isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const;
+
+    virtual bool acceptsPreconditionerFactory() const;
+
+    virtual void setPreconditionerFactory(const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> >& precFactory,
+                                          const std::string& precFactoryName);
+
+    virtual Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> > getPreconditionerFactory() const;
+
+    virtual void unsetPreconditionerFactory(Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST> >* precFactory,
+                                            std::string* precFactoryName);
+
+    virtual bool supportsPreconditionerInputType(const Thyra::EPreconditionerInputType precOpType) const;
+
+    virtual Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST> > createOp() const;
+
+    virtual void initializeOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                              Thyra::LinearOpWithSolveBase<ST>* Op,
+                              const Thyra::ESupportSolveUse supportSolveUse) const;
+
+    virtual void initializeAndReuseOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                                      Thyra::LinearOpWithSolveBase<ST>* Op) const;
+
+    virtual void initializePreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                                            const Teuchos::RCP<const Thyra::PreconditionerBase<ST> >& prec,
+                                            Thyra::LinearOpWithSolveBase<ST>* Op,
+                                            const Thyra::ESupportSolveUse supportSolveUse) const;
+
+    virtual void initializeApproxPreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+                                                  const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& approxFwdOpSrc,
+                                                  Thyra::LinearOpWithSolveBase<ST>* Op,
+                                                  const Thyra::ESupportSolveUse supportSolveUse) const;
+
+    virtual void uninitializeOp(Thyra::LinearOpWithSolveBase<ST>* Op,
+                                Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* fwdOpSrc,
+                                Teuchos::RCP<const Thyra::PreconditionerBase<ST> >* prec,
+                                Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* approxFwdOpSrc,
+                                Thyra::ESupportSolveUse* supportSolveUse) const;
+
+    virtual void setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList);
+
+    virtual Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList();
+
+    virtual Teuchos::RCP<Teuchos::ParameterList> unsetParameterList();
+
+    virtual Teuchos::RCP<const Teuchos::ParameterList> getParameterList() const;
+
+    virtual Teuchos::RCP<const Teuchos::ParameterList> getValidParameters() const;
+
+    virtual std::string description() const;
+
+    //@}
+
+  private:
+
+    //! Count a Jacobian, and a preconditioner computation if recomputed
+    void recordInitialization(const bool recomputed) const;
+
+    Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> > lowsFactory;
+    int reuseInterval;
+    double rebuildIterationRatio;
+
+    Teuchos::RCP<Teuchos::ParameterList> statsParams;
+    mutable int numJacobians;
+    mutable int numPrecComputations;
+
+  }; // class PrecReuseLOWSFactory
+
+} // namespace Albany
+
+#endif // ALBANY_PREC_REUSE_LOWS_FACTORY_HPP
@@ -18,6 +18,8 @@
 #endif
 #include "Albany_PiroObserverT.hpp"
 #include "Albany_ModelFactory.hpp"
+#include "Albany_CentralDifferenceSolverT.hpp"
+#include "Albany_PrecReuseLOWSFactory.hpp"
 
 #include "Piro_ProviderBase.hpp"
 
@@ -719,10 +721,11 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
 #ifdef ALBANY_TEKO
     Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
 #endif
+    Albany::PrecReuseLOWSFactory::setMueLuReuse(piroParams, stratList);
     linearSolverBuilder.setParameterList(stratList);
 
     const RCP<Thyra::LinearOpWithSolveFactoryBase<ST> > lowsFactory =
-        createLinearSolveStrategy(linearSolverBuilder);
+        Albany::PrecReuseLOWSFactory::create(createLinearSolveStrategy(linearSolverBuilder), piroParams);
 
     const RCP<LCM::SchwarzMultiscale> coupled_model_with_solveT = rcp(new LCM::SchwarzMultiscale(appParams, solverComm,
                                                                          initial_guess, lowsFactory));
@@ -745,6 +748,14 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
   albanyApp = app;
 
   const RCP<ParameterList> piroParams = Teuchos::sublist(appParams, "Piro");
+
+  // Explicit dynamics needs neither a linear solver nor Piro
+  if (piroParams->isType<std::string>("Solver Type") &&
+      piroParams->get<std::string>("Solver Type") == "Central Difference") {
+    const RCP<Piro::ObserverBase<double> > observer = rcp(new PiroObserverT(app, modelT));
+    return rcp(new Albany::CentralDifferenceSolverT(app, modelT, piroParams, observer));
+  }
+
   const Teuchos::RCP<Teuchos::ParameterList> stratList = Piro::extractStratimikosParams(piroParams);
 
   if(Teuchos::is_null(stratList)){
@@ -770,10 +781,11 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
 #ifdef ALBANY_TEKO
     Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
 #endif
+    Albany::PrecReuseLOWSFactory::setMueLuReuse(piroParams, stratList);
     linearSolverBuilder.setParameterList(stratList);
 
     const RCP<Thyra::LinearOpWithSolveFactoryBase<ST> > lowsFactory =
-      createLinearSolveStrategy(linearSolverBuilder);
+      Albany::PrecReuseLOWSFactory::create(createLinearSolveStrategy(linearSolverBuilder), piroParams);
 
     modelWithSolveT =
       rcp(new Thyra::DefaultModelEvaluatorWithSolveFactory<ST>(modelT, lowsFactory));
@@ -959,6 +971,20 @@ int Albany::SolverFactory::checkSolveTestResultsT(
     }
   }
 
+  // Check that the preconditioner was reused, once per run
+  const double maxPrecRatio = testParams->get<double>("Maximum Preconditioner Computation Ratio");
+  if (maxPrecRatio > 0.0 && response_index == 0 && parameter_index == 0) {
+    ParameterList& reuseParams =
+      appParams->sublist("Piro").sublist("Preconditioner Reuse");
+    const int numJacobians = reuseParams.get("Number of Jacobians", 0);
+    const int numPrecComputations = reuseParams.get("Number of Preconditioner Computations", 0);
+    *out << "\nPreconditioner computed " << numPrecComputations << " times for "
+         << numJacobians << " Jacobians" << std::endl;
+    if (numJacobians == 0 || numPrecComputations > maxPrecRatio*numJacobians)
+      failures += 1;
+    comparisons++;
+  }
+
   storeTestResults(testParams, failures, comparisons);
 
   return failures;
@@ -1284,6 +1310,7 @@ Albany::SolverFactory::getValidAppParameters() const
   validPL->sublist("VTK",                false, "DEPRECATED  VTK sublist");
   validPL->sublist("Piro",               false, "Piro sublist");
   validPL->sublist("Coupled System",     false, "Coupled system sublist");
+  validPL->sublist("Ensemble",           false, "Ensemble sampling sublist (AlbanyEnsembleT)");
 
   // validPL->set<std::string>("Jacobian Operator", "Have Jacobian", "Flag to allow Matrix-Free specification in Piro");
   // validPL->set<double>("Matrix-Free Perturbation", 3.0e-7, "delta in matrix-free formula");
@@ -1350,6 +1377,9 @@ Albany::SolverFactory::getValidRegressionResultsParameters() const
     "Stochastic Galerkin Standard Deviation Test Values", ta,
     "Array of regression values for SG standard deviation responses");
 
+  validPL->set<double>("Maximum Preconditioner Computation Ratio", 0.0,
+          "Largest allowed ratio of preconditioner computations to Jacobians under \"Preconditioner Reuse\" (0 disables)");
+
   // These two are typically not set on input, just output.
   validPL->set<int>("Number of Failures", 0,
      "Output information from regression tests reporting number of failed tests");
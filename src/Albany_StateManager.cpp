@@ -12,6 +12,32 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Teuchos_TestForException.hpp"
 
+#include <algorithm>
+
+namespace {
+
+// Copy a state into its "_old" state in every workset, one block copy per
+// workset. The map lookups happen once per workset, not once per entry.
+void copyToOldState(Albany::StateArrayVec& sa, const std::string& stateName,
+                    const std::string& stateName_old)
+{
+  for (std::size_t ws = 0; ws < sa.size(); ws++) {
+    Albany::StateArray::iterator cur = sa[ws].find(stateName);
+    Albany::StateArray::iterator old = sa[ws].find(stateName_old);
+    if (cur == sa[ws].end() || old == sa[ws].end()) continue;
+
+    TEUCHOS_TEST_FOR_EXCEPTION(old->second.size() != cur->second.size(),
+        std::logic_error, "Error: state " << stateName_old << " has "
+        << old->second.size() << " entries but " << stateName << " has "
+        << cur->second.size() << " in workset " << ws << std::endl);
+
+    const double* src = cur->second.contiguous_data();
+    std::copy(src, src + cur->second.size(), old->second.contiguous_data());
+  }
+}
+
+}
+
 Albany::StateManager::StateManager() :
   stateVarsAreAllocated (false),
   stateInfo             (Teuchos::rcp(new StateInfoStruct))
@@ -726,10 +752,8 @@ Albany::StateManager::updateStates()
   Albany::StateArrays& sa = disc->getStateArrays();
   Albany::StateArrayVec& esa = sa.elemStateArrays;
   Albany::StateArrayVec& nsa = sa.nodeStateArrays;
-  int numElemWorksets = esa.size();
-  int numNodeWorksets = nsa.size();
 
-  // For each workset, loop over registered states
+  // For each registered state, copy into the old state in every workset
 
   for (unsigned int i=0; i<stateInfo->size(); i++) {
     if ((*stateInfo)[i]->saveOldState) {
@@ -739,26 +763,20 @@ Albany::StateManager::updateStates()
       switch((*stateInfo)[i]->entity){
 
       case Albany::StateStruct::NodalDataToElemNode :
-        for (int ws = 0; ws < numNodeWorksets; ws++)
-           for (int j = 0; j < nsa[ws][stateName].size(); j++)
-             nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+        copyToOldState(nsa, stateName, stateName_old);
 
       case Albany::StateStruct::WorksetValue :
       case Albany::StateStruct::ElemData :
       case Albany::StateStruct::QuadPoint :
       case Albany::StateStruct::ElemNode :
 
-        for (int ws = 0; ws < numElemWorksets; ws++)
-          for (int j = 0; j < esa[ws][stateName].size(); j++)
-            esa[ws][stateName_old][j] = esa[ws][stateName][j];
+        copyToOldState(esa, stateName, stateName_old);
 
         break;
 
       case Albany::StateStruct::NodalData :
 
-        for (int ws = 0; ws < numNodeWorksets; ws++)
-          for (int j = 0; j < nsa[ws][stateName].size(); j++)
-            nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+        copyToOldState(nsa, stateName, stateName_old);
 
         break;
 
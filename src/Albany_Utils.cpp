@@ -6,6 +6,7 @@
 
 #include "Albany_Utils.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
 #include <cstdlib>
 #include <stdexcept>
 
@@ -246,6 +247,45 @@
     }
   }
 
+  bool Albany::requestsAsyncOutput(const std::string& xml_filename) {
+    Teuchos::ParameterList params;
+    try {
+      Teuchos::updateParametersFromXmlFile(xml_filename, Teuchos::ptrFromRef(params));
+    }
+    catch (const std::exception&) {
+      return false;
+    }
+    return params.isSublist("Discretization") &&
+      params.sublist("Discretization").get<bool>("Asynchronous Exodus Output", false);
+  }
+
+  Albany::MPISession::MPISession(int* argc, char*** argv, const bool threads,
+                                 std::ostream* out)
+    : finalize(false) {
+#ifdef ALBANY_MPI
+    if (threads) {
+      // Teuchos::GlobalMPISession cannot request a thread level and must
+      // not be constructed once MPI is started; its static queries and the
+      // default Teuchos comm still find MPI through MPI_Initialized.
+      int provided;
+      MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
+      finalize = true;
+      int rank;
+      MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+      if (out && rank == 0 && provided < MPI_THREAD_MULTIPLE)
+        *out << "Warning: MPI does not provide MPI_THREAD_MULTIPLE" << std::endl;
+      return;
+    }
+#endif
+    session = Teuchos::rcp(new Teuchos::GlobalMPISession(argc, argv, out));
+  }
+
+  Albany::MPISession::~MPISession() {
+#ifdef ALBANY_MPI
+    if (finalize) MPI_Finalize();
+#endif
+  }
+
   void Albany::connect_vtune(const int p_rank) {
     std::stringstream cmd;
     pid_t my_os_pid=getpid();
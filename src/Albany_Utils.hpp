@@ -25,8 +25,11 @@
   #include "Teuchos_DefaultSerialComm.hpp"
 #endif
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
 #include "Albany_DataTypes.hpp"
 
+#include <iostream>
+
 namespace Albany {
 
 #if defined(ALBANY_EPETRA)
@@ -87,6 +90,28 @@ namespace Albany {
     void parse_cmdline(int argc , char ** argv, std::ostream& os);
   };
 
+  //! Whether the input file turns on "Asynchronous Exodus Output". Read on
+  //! every rank before MPI starts; false if the file cannot be read, which
+  //! the solver factory reports later.
+  bool requestsAsyncOutput(const std::string& xml_filename);
+
+  //! Starts MPI for an executable and finalizes it on destruction. With
+  //! threads, MPI is initialized with MPI_THREAD_MULTIPLE, which the
+  //! asynchronous Exodus writer needs on several ranks; otherwise this is
+  //! a Teuchos::GlobalMPISession.
+  class MPISession {
+  public:
+    MPISession(int* argc, char*** argv, const bool threads,
+               std::ostream* out = &std::cout);
+    ~MPISession();
+  private:
+    MPISession(const MPISession&);
+    MPISession& operator=(const MPISession&);
+
+    Teuchos::RCP<Teuchos::GlobalMPISession> session;
+    bool finalize;
+  };
+
   // Connect executable to vtune for profiling
   void connect_vtune(const int p_rank);
 
@@ -0,0 +1,113 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_WorksetColoring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+thread_local bool in_parallel_fill = false;
+}
+
+Teuchos::Array<Teuchos::Array<int> >
+Albany::colorWorksets(
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type& wsElNodeEqID)
+{
+  const int numWorksets = wsElNodeEqID.size();
+
+  // Unique overlapped DOFs touched by each workset.
+  std::vector<std::vector<LO> > wsDofs(numWorksets);
+  LO maxDof = -1;
+  for (int ws = 0; ws < numWorksets; ++ws) {
+    std::vector<LO>& dofs = wsDofs[ws];
+    for (int cell = 0; cell < wsElNodeEqID[ws].size(); ++cell)
+      for (int node = 0; node < wsElNodeEqID[ws][cell].size(); ++node)
+        for (int eq = 0; eq < wsElNodeEqID[ws][cell][node].size(); ++eq)
+          dofs.push_back(wsElNodeEqID[ws][cell][node][eq]);
+    std::sort(dofs.begin(), dofs.end());
+    dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+    if (!dofs.empty()) maxDof = std::max(maxDof, dofs.back());
+  }
+
+  // Inverse map: worksets touching each DOF.
+  std::vector<std::vector<int> > dofWorksets(maxDof + 1);
+  for (int ws = 0; ws < numWorksets; ++ws)
+    for (std::size_t i = 0; i < wsDofs[ws].size(); ++i)
+      dofWorksets[wsDofs[ws][i]].push_back(ws);
+
+  // First-fit coloring in workset order.
+  std::vector<int> color(numWorksets, -1);
+  std::vector<int> forbidden;
+  int numColors = 0;
+  for (int ws = 0; ws < numWorksets; ++ws) {
+    forbidden.assign(numColors + 1, -1);
+    for (std::size_t i = 0; i < wsDofs[ws].size(); ++i) {
+      const std::vector<int>& nbrs = dofWorksets[wsDofs[ws][i]];
+      for (std::size_t j = 0; j < nbrs.size(); ++j)
+        if (color[nbrs[j]] >= 0) forbidden[color[nbrs[j]]] = ws;
+    }
+    int c = 0;
+    while (forbidden[c] == ws) ++c;
+    color[ws] = c;
+    numColors = std::max(numColors, c + 1);
+  }
+
+  Teuchos::Array<Teuchos::Array<int> > colors(numColors);
+  for (int ws = 0; ws < numWorksets; ++ws)
+    colors[color[ws]].push_back(ws);
+  return colors;
+}
+
+void
+Albany::parallelForWorksets(
+  const int n, const int num_threads,
+  const std::function<void (const int i, const int tid)>& f)
+{
+  const int nt = std::max(1, std::min(num_threads, n));
+  if (nt == 1) {
+    for (int i = 0; i < n; ++i) f(i, 0);
+    return;
+  }
+
+  std::atomic<int> next(0);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&](const int tid) {
+    in_parallel_fill = true;
+    for (int i = next++; i < n; i = next++) {
+      try {
+        f(i, tid);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) error = std::current_exception();
+        next = n;
+      }
+    }
+    in_parallel_fill = false;
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nt - 1);
+  for (int tid = 1; tid < nt; ++tid)
+    threads.push_back(std::thread(worker, tid));
+  worker(0);
+  for (std::size_t t = 0; t < threads.size(); ++t)
+    threads[t].join();
+
+  if (error) std::rethrow_exception(error);
+}
+
+bool
+Albany::inParallelWorksetFill()
+{
+  return in_parallel_fill;
+}
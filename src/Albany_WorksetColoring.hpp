@@ -0,0 +1,52 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_WORKSETCOLORING_HPP
+#define ALBANY_WORKSETCOLORING_HPP
+
+#include <functional>
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ArrayRCP.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractDiscretization.hpp"
+
+namespace Albany {
+
+  //! Greedy coloring of the worksets of a discretization.
+  /*!
+   * Two worksets receive different colors whenever they share at least one
+   * overlapped DOF (local row of the overlapped residual and Jacobian). All
+   * worksets of one color can therefore be scattered concurrently without
+   * atomics or locks. Entry i of the returned array lists the worksets of
+   * color i in increasing order.
+   */
+  Teuchos::Array<Teuchos::Array<int> >
+  colorWorksets(
+    const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type& wsElNodeEqID);
+
+  //! Calls f(i, tid) for every i in [0, n) using num_threads threads.
+  /*!
+   * Iterations are handed out dynamically; tid in [0, num_threads) identifies
+   * the calling thread so that f can use per-thread resources. The first
+   * exception thrown by any f is rethrown on the calling thread after all
+   * threads have joined.
+   */
+  void
+  parallelForWorksets(
+    const int n, const int num_threads,
+    const std::function<void (const int i, const int tid)>& f);
+
+  //! True on the threads running the body of a multi-threaded parallelForWorksets.
+  /*!
+   * Evaluators use this to skip shared bookkeeping, such as the Teuchos
+   * timers of the PerformanceContext, that is not thread safe.
+   */
+  bool inParallelWorksetFill();
+
+}
+
+#endif // ALBANY_WORKSETCOLORING_HPP
@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "Albany_AbstractDiscretization.hpp"
 
 #include "PHAL_AlbanyTraits.hpp"
 
@@ -53,6 +54,19 @@ protected:
   std::string meshPart;
 
   Teuchos::RCP<const CellTopologyData> cell_topo;
+
+  //! Fill columnAverage for the columns touched by the sides, streaming each
+  //! column once instead of once per side node
+  void computeColumnAverages(typename Traits::EvalData workset,
+                             const Albany::LayeredColumns& columns,
+                             const std::vector<Albany::SideStruct>& sideSet);
+
+  //! Trapezoidal weights of the levels
+  std::vector<double> quadWeights;
+
+  //! Averaged velocity component comp of column c at c*vecDimFO + comp
+  std::vector<double> columnAverage;
+  std::vector<char> columnDone;
 };
 
 
@@ -56,6 +56,42 @@ postRegistrationSetup(typename Traits::SetupData d,
 }
 
 //**********************************************************************
+template<typename EvalT, typename Traits>
+void GatherVerticallyAveragedVelocityBase<EvalT, Traits>::
+computeColumnAverages(typename Traits::EvalData workset,
+                      const Albany::LayeredColumns& columns,
+                      const std::vector<Albany::SideStruct>& sideSet)
+{
+  Teuchos::ArrayRCP<const ST> xT_constView = workset.xT->get1dView();
+
+  const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
+  const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
+  const int numLevels = layeredMeshNumbering.numLevels;
+
+  Albany::LayeredColumns::trapezoidWeights(layeredMeshNumbering.layers_ratio, quadWeights);
+
+  columnAverage.assign(columns.getNumColumns()*vecDimFO, 0.0);
+  columnDone.assign(columns.getNumColumns(), 0);
+
+  for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) {
+    const int elem_LID = sideSet[iSide].elem_LID;
+    const CellTopologyData_Subcell& side = cell_topo->side[sideSet[iSide].side_local_id];
+    for (int i = 0; i < side.topology->node_count; ++i) {
+      const int c = columns.getColumn(elem_LID, side.node[i]);
+      if (columnDone[c]) continue;
+      columnDone[c] = 1;
+
+      double* avVel = &columnAverage[c*vecDimFO];
+      for (int il = 0; il < numLevels; ++il) {
+        LO inode = layeredMeshNumbering.getId(columns.getColumnId(c), il);
+        for (int comp = 0; comp < vecDimFO; ++comp)
+          avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+      }
+    }
+  }
+}
+
+//**********************************************************************
 
 
 
@@ -70,9 +106,6 @@ template<typename Traits>
 void GatherVerticallyAveragedVelocity<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP<const Tpetra_Vector> xT = workset.xT;
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
-
   Kokkos::deep_copy(this->averagedVel.get_view(), ScalarT(0.0));
 
   if (workset.sideSets == Teuchos::null)
@@ -84,42 +117,22 @@ evaluateFields(typename Traits::EvalData workset)
   if (it != ssList.end()) {
     const std::vector<Albany::SideStruct>& sideSet = it->second;
 
-    // Loop over the sides that form the boundary condition
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-    const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
-    const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
-
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    Albany::LayeredColumns scratch;
+    const Albany::LayeredColumns& columns = Albany::LayeredColumns::get(*workset.disc, workset.wsIndex, scratch);
+    this->computeColumnAverages(workset, columns, sideSet);
 
+    // Loop over the sides that form the boundary condition
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
       // Get the data that corresponds to the side
-      const int elem_GID = sideSet[iSide].elem_GID;
       const int elem_LID = sideSet[iSide].elem_LID;
       const int elem_side = sideSet[iSide].side_local_id;
       const CellTopologyData_Subcell& side =  this->cell_topo->side[elem_side];
       int numSideNodes = side.topology->node_count;
 
-      const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[elem_LID];
-
       //we only consider elements on the top.
-      LO baseId, ilayer;
       for (int i = 0; i < numSideNodes; ++i) {
         std::size_t node = side.node[i];
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
-        }
+        const double* avVel = &this->columnAverage[columns.getColumn(elem_LID,node)*this->vecDimFO];
         for(int comp=0; comp<this->vecDimFO; ++comp)
           this->averagedVel(elem_LID,node,comp) = avVel[comp];
       }
@@ -139,9 +152,6 @@ template<typename Traits>
 void GatherVerticallyAveragedVelocity<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP<const Tpetra_Vector> xT = workset.xT;
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
-
   if (workset.sideSets == Teuchos::null)
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
@@ -157,42 +167,23 @@ evaluateFields(typename Traits::EvalData workset)
   if (it != ssList.end()) {
     const std::vector<Albany::SideStruct>& sideSet = it->second;
 
-    // Loop over the sides that form the boundary condition
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-    const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
-
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    Albany::LayeredColumns scratch;
+    const Albany::LayeredColumns& columns = Albany::LayeredColumns::get(*workset.disc, workset.wsIndex, scratch);
+    this->computeColumnAverages(workset, columns, sideSet);
+    const std::vector<double>& quadWeights = this->quadWeights;
 
+    // Loop over the sides that form the boundary condition
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
 
       // Get the data that corresponds to the side
-      const int elem_GID = sideSet[iSide].elem_GID;
       const int elem_LID = sideSet[iSide].elem_LID;
       const int elem_side = sideSet[iSide].side_local_id;
       const CellTopologyData_Subcell& side =  this->cell_topo->side[elem_side];
       int numSideNodes = side.topology->node_count;
 
-      const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[elem_LID];
-      std::vector<double> velx(this->numNodes,0), vely(this->numNodes,0);
-
-      LO baseId, ilayer;
       for (int i = 0; i < numSideNodes; ++i) {
         std::size_t node = side.node[i];
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
-        }
+        const double* avVel = &this->columnAverage[columns.getColumn(elem_LID,node)*this->vecDimFO];
 
         for(int comp=0; comp<this->vecDimFO; ++comp) {
           this->averagedVel(elem_LID,node,comp) = FadType(this->averagedVel(elem_LID,node,comp).size(), avVel[comp]);
@@ -228,9 +219,6 @@ template<typename Traits>
 void GatherVerticallyAveragedVelocity<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP<const Tpetra_Vector> xT = workset.xT;
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
-
   Kokkos::deep_copy(this->averagedVel.get_view(), ScalarT(0.0));
 
   if (workset.sideSets == Teuchos::null)
@@ -242,42 +230,22 @@ evaluateFields(typename Traits::EvalData workset)
   if (it != ssList.end()) {
     const std::vector<Albany::SideStruct>& sideSet = it->second;
 
-    // Loop over the sides that form the boundary condition
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-    const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
-    const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
-
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    Albany::LayeredColumns scratch;
+    const Albany::LayeredColumns& columns = Albany::LayeredColumns::get(*workset.disc, workset.wsIndex, scratch);
+    this->computeColumnAverages(workset, columns, sideSet);
 
+    // Loop over the sides that form the boundary condition
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
       // Get the data that corresponds to the side
-      const int elem_GID = sideSet[iSide].elem_GID;
       const int elem_LID = sideSet[iSide].elem_LID;
       const int elem_side = sideSet[iSide].side_local_id;
       const CellTopologyData_Subcell& side =  this->cell_topo->side[elem_side];
       int numSideNodes = side.topology->node_count;
 
-      const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[elem_LID];
-
       //we only consider elements on the top.
-      LO baseId, ilayer;
       for (int i = 0; i < numSideNodes; ++i) {
         std::size_t node = side.node[i];
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
-        }
+        const double* avVel = &this->columnAverage[columns.getColumn(elem_LID,node)*this->vecDimFO];
         for(int comp=0; comp<this->vecDimFO; ++comp)
           this->averagedVel(elem_LID,node,comp) = avVel[comp];
       }
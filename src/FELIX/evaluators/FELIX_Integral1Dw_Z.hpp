@@ -52,6 +52,9 @@ protected:
   bool StokesThermoCoupled;
 
   int offset, neq;
+
+  //! Integral from the base to each level of each column of the workset
+  std::vector<double> levelIntegral;
 };
 
 template<typename EvalT, typename Traits> class Integral1Dw_Z;
@@ -76,34 +76,22 @@ evaluateFields(typename Traits::EvalData workset)
 
     Kokkos::deep_copy(this->int1Dw_z.get_view(), ScalarT(0.0));
 
-  	const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
-    LO baseId, ilayer;
+    const int numLevels = layeredMeshNumbering.numLevels;
 
-    for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
-    {
-    	const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
+    Albany::LayeredColumns scratch;
+    const Albany::LayeredColumns& columns = Albany::LayeredColumns::get(*workset.disc, workset.wsIndex, scratch);
 
+    // Integral from the base to every level, one pass per column
+    const int offset = this->offset;
+    columns.integrateUp(layeredMeshNumbering,
+        [&](const LO inode) { return xT_constView[solDOFManager.getLocalDOF(inode, offset)]; },
+        this->levelIntegral);
+
+    for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     	for (std::size_t node = 0; node < this->numNodes; ++node)
-    	{
-    		LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-    		layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-    		double int1D = 0;
-
-    		for (int il = 0; il < ilayer; ++il)
-    		{
-    			LO inode0 = layeredMeshNumbering.getId(baseId, il);
-    			LO inode1 = layeredMeshNumbering.getId(baseId, il+1);
-    			int1D += 0.5 * ( xT_constView[solDOFManager.getLocalDOF(inode0, this->offset)] + xT_constView[solDOFManager.getLocalDOF(inode1, this->offset)] ) * layers_ratio[il];
-    		}
-
-    		this->int1Dw_z(cell,node) = int1D;
-    	}
-    }
+    		this->int1Dw_z(cell,node) = this->levelIntegral[columns.getColumn(cell,node)*numLevels + columns.getLevel(cell,node)];
 }
 
 // Specialization for AlbanyTraits::Jacobian
@@ -124,45 +112,36 @@ evaluateFields(typename Traits::EvalData workset)
 
   	Kokkos::deep_copy(this->int1Dw_z.get_view(), ScalarT(0.0));
 
-  	const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
     const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
+    const int numLevels = layeredMeshNumbering.numLevels;
+
+    Albany::LayeredColumns scratch;
+    const Albany::LayeredColumns& columns = Albany::LayeredColumns::get(*workset.disc, workset.wsIndex, scratch);
 
-    LO baseId, ilevel, baseId_curr, ilevel_curr;
+    const int offset = this->offset;
+    columns.integrateUp(layeredMeshNumbering,
+        [&](const LO inode) { return xT_constView[solDOFManager.getLocalDOF(inode, offset)]; },
+        this->levelIntegral);
 
     for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     {
-    	const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
-
     	for (std::size_t node = 0; node < this->numNodes; ++node)
     	{
-    		LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-    		layeredMeshNumbering.getIndices(lnodeId, baseId, ilevel);
-
-    		double int1D = 0;
-
-    		for (int il = 0; il < ilevel; ++il)
-    		{
-    			LO inode0 = layeredMeshNumbering.getId(baseId, il);
-    			LO inode1 = layeredMeshNumbering.getId(baseId, il+1);
-    			int1D += 0.5 * ( xT_constView[solDOFManager.getLocalDOF(inode0, this->offset)] + xT_constView[solDOFManager.getLocalDOF(inode1, this->offset)] ) * layers_ratio[il];
-    		}
+    		const int column = columns.getColumn(cell,node);
+    		const int ilevel = columns.getLevel(cell,node);
 
-    		this->int1Dw_z(cell,node) = FadType(this->int1Dw_z(cell,node).size(), int1D);
-            //std::cout << "this->int1Dw_z(cell,node).size() = " << this->int1Dw_z(cell,node).size() << std::endl;
+    		this->int1Dw_z(cell,node) = FadType(this->int1Dw_z(cell,node).size(), this->levelIntegral[column*numLevels + ilevel]);
 
+    		// Only the nodes of this cell in the same column carry derivatives
     		for (std::size_t node_curr = 0; node_curr < this->numNodes; ++node_curr)
         	{
-        		LO lnodeId_curr = nodeID[node_curr];
-        	    layeredMeshNumbering.getIndices(lnodeId_curr, baseId_curr, ilevel_curr);
-        	    if (baseId_curr == baseId)
+        	    if (columns.getColumn(cell,node_curr) == column)
         	    {
+        	    	const int ilevel_curr = columns.getLevel(cell,node_curr);
         	    	int idx = this->neq * node_curr + this->offset;
-        	    	//int idx = this->offset * this->numNodes + node_curr;
 
         	    	if(ilevel_curr == ilevel - 1)
 					{
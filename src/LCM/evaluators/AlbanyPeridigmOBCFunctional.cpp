@@ -193,7 +193,7 @@ evaluateSGGradient(
   Stokhos::EpetraMultiVectorOrthogPoly* sg_dg_dp)
 {}
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::AlbanyPeridigmOBCFunctional::
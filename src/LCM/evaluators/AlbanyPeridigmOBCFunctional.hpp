@@ -159,7 +159,7 @@ namespace Albany {
 
     //@}
 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
     //! \name Multi-point evaluation functions
     //@{
 
@@ -84,6 +84,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "EquilibriumConcentrationBC: not supported with Block CRS Jacobian storage." << std::endl);
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int>>& nsNodes =
@@ -220,6 +220,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "KfieldBC: not supported with Block CRS Jacobian storage." << std::endl);
 
 
   RealType time = dirichletWorkset.current_time;
@@ -649,6 +651,7 @@ template<typename Traits>
 void KfieldBC<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x =
@@ -677,6 +680,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       (*f)[block][ylunk] = ((*x)[block][ylunk] - Yval.coeff(block));
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "KfieldBC<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -693,6 +700,7 @@ template<typename Traits>
 void KfieldBC<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix>> jac =
@@ -751,6 +759,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "KfieldBC<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -767,6 +779,7 @@ template<typename Traits>
 void KfieldBC<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> fp =
@@ -827,6 +840,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
     }
 
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "KfieldBC<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -45,6 +45,10 @@ public:
 
   SchwarzBC_Base(Teuchos::ParameterList & p);
 
+  // Must be called before each loop of computeBCs over the node set.
+  void
+  refreshCoupledSolution();
+
   void
   computeBCs(
       size_t const ns_node,
@@ -136,6 +140,42 @@ protected:
 
   int
   coupled_app_index_;
+
+private:
+
+  bool
+  isPointCacheCurrent() const;
+
+  void
+  buildPointCache();
+
+  // Coupled mesh generation and node set size the point cache was built for.
+  int
+  cached_mesh_generation_;
+
+  size_t
+  cached_number_points_;
+
+  int
+  cached_dimension_;
+
+  int
+  cached_vertex_count_;
+
+  // For each node set point, the overlap local ids of the vertices of the
+  // containing coupled element and the shape functions at the point.
+  std::vector<LO>
+  cached_vertex_ids_;
+
+  std::vector<double>
+  cached_basis_values_;
+
+  // Coupled solution for the current node set loop.
+  Teuchos::RCP<Tpetra_Vector const>
+  coupled_solution_;
+
+  Teuchos::ArrayRCP<ST const>
+  coupled_solution_view_;
 };
 
 //
@@ -4,9 +4,13 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <limits>
+
 #include "Albany_Application.hpp"
 #include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_STKDiscretization.hpp"
+#include "BoxGrid.h"
 #include "Intrepid2_MiniTensor.h"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -39,7 +43,11 @@ SchwarzBC_Base(Teuchos::ParameterList & p) :
         "Application", Teuchos::null)),
     coupled_apps_(app_->getApplications()),
     coupled_app_name_(p.get<std::string>("Coupled Application", "SELF")),
-    coupled_block_name_(p.get<std::string>("Coupled Block", "NONE"))
+    coupled_block_name_(p.get<std::string>("Coupled Block", "NONE")),
+    cached_mesh_generation_(-1),
+    cached_number_points_(0),
+    cached_dimension_(0),
+    cached_vertex_count_(0)
 {
   std::string const &
   nodeset_name = this->nodeSetID;
@@ -79,17 +87,45 @@ SchwarzBC_Base(Teuchos::ParameterList & p) :
 //
 //
 template<typename EvalT, typename Traits>
-void
+bool
 SchwarzBC_Base<EvalT, Traits>::
-computeBCs(
-    size_t const ns_node,
-    ScalarT & x_val,
-    ScalarT & y_val,
-    ScalarT & z_val)
+isPointCacheCurrent() const
 {
-  Teuchos::RCP<Teuchos::FancyOStream> 
-  out = Teuchos::fancyOStream(Teuchos::VerboseObjectBase::getDefaultOStream());
+  Albany::Application const &
+  this_app = getApplication(getThisAppIndex());
 
+  Albany::Application const &
+  coupled_app = getApplication(getCoupledAppIndex());
+
+  auto *
+  this_stk_disc =
+      static_cast<Albany::STKDiscretization *>(this_app.getDiscretization().get());
+
+  auto *
+  coupled_stk_disc =
+      static_cast<Albany::STKDiscretization *>(coupled_app.getDiscretization().get());
+
+  std::string const &
+  coupled_nodeset_name = this_app.getNodesetName(getCoupledAppIndex());
+
+  auto const
+  number_points =
+      this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second.size();
+
+  return cached_mesh_generation_ == coupled_stk_disc->getMeshGeneration() &&
+      cached_number_points_ == number_points;
+}
+
+//
+// Locate every node set point in the coupled mesh and store the vertices
+// and shape function values of the containing element. The coupled mesh
+// does not move, so this is done once per coupled discretization.
+//
+template<typename EvalT, typename Traits>
+void
+SchwarzBC_Base<EvalT, Traits>::
+buildPointCache()
+{
   auto const
   this_app_index = getThisAppIndex();
 
@@ -178,6 +214,36 @@ computeBCs(
   coupled_element_type =
       Intrepid2::find_type(coupled_dimension, coupled_vertex_count);
 
+  auto
+  parametric_dimension = 0;
+
+  Teuchos::RCP<Intrepid2::Basis<double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>>
+  basis;
+
+  switch (coupled_element_type) {
+
+  default:
+    std::cerr << "\nERROR: " << __PRETTY_FUNCTION__ << '\n';
+    std::cerr << "Unknown element type: " << coupled_element_type << '\n';
+    exit(1);
+    break;
+
+  case Intrepid2::ELEMENT::TETRAHEDRAL:
+    parametric_dimension = 3;
+
+    basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_TET_C1_FEM<
+        double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>());
+    break;
+
+  case Intrepid2::ELEMENT::HEXAHEDRAL:
+    parametric_dimension = 3;
+
+    basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_HEX_C1_FEM<
+        double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>());
+    break;
+
+  } // switch
+
   std::string const &
   coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
 
@@ -188,16 +254,11 @@ computeBCs(
   auto const &
   ws_elem_2_node_id = coupled_stk_disc->getWsElNodeID();
 
-  std::vector<Intrepid2::Vector<double>>
-  coupled_element_vertices(coupled_vertex_count);
-
-  std::vector<Intrepid2::Vector<double>>
-  coupled_element_solution(coupled_vertex_count);
+  Teuchos::ArrayRCP<double> const &
+  coupled_coordinates = coupled_stk_disc->getCoordinates();
 
-  for (auto i = 0; i < coupled_vertex_count; ++i) {
-    coupled_element_vertices[i].set_dimension(coupled_dimension);
-    coupled_element_solution[i].set_dimension(coupled_dimension);
-  }
+  Teuchos::RCP<Tpetra_Map const>
+  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
 
   // This tolerance is used for geometric approximations. It will be used
   // to determine whether a node of this_app is inside an element of
@@ -205,54 +266,16 @@ computeBCs(
   double const
   tolerance = 5.0e-2;
 
-  double * const
-  coord = ns_coord[ns_node];
-
-  Intrepid2::Vector<double>
-  point;
-
-  point.set_dimension(coupled_dimension);
-
-  point.fill(coord);
-
-#if defined(DEBUG_LCM_SCHWARZ)
-  std::cout << "--------------------------------------------------------\n";
-  std::cout << "Current app      : " << this_app_name << '\n';
-  std::cout << "Coupling to app  : " << coupled_app_name << '\n';
-  std::cout << "Coupling to block: " << coupled_block_name << '\n';
-  std::cout << "Node set node    : " << ns_node << '\n';
-  std::cout << "Point            : " << point << '\n';
-  std::cout << "--------------------------------------------------------\n";
-#endif // DEBUG_LCM_SCHWARZ
-
-  // Determine the element that contains this point.
-  bool
-  found = false;
-
-  auto
-  parametric_dimension = 0;
-
-  Teuchos::RCP<Intrepid2::Basis<double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>>
-  basis;
-
-  Teuchos::ArrayRCP<double> const &
-  coupled_coordinates = coupled_stk_disc->getCoordinates();
+  // Vertices of the candidate elements, in workset and element order, and
+  // their bounding boxes grown by the tolerance.
+  std::vector<LO>
+  element_vertex_ids;
 
-  Teuchos::RCP<Tpetra_Vector const>
-  coupled_solution = coupled_stk_disc->getSolutionFieldT();
+  std::vector<double>
+  box_lower;
 
-#if defined(DEBUG_LCM_SCHWARZ)
-  if (ns_node == 0) { 
-    *out << "coupled_solution: \n"; 
-    coupled_solution->describe(*out, Teuchos::VERB_EXTREME);  
-  }
-#endif //DEBUG_LCM_SCHWARZ  
- 
-  Teuchos::ArrayRCP<ST const>
-  coupled_solution_view = coupled_solution->get1dView();
-
-  Teuchos::RCP<Tpetra_Map const>
-  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
+  std::vector<double>
+  box_upper;
 
   for (auto workset = 0; workset < ws_elem_2_node_id.size(); ++workset) {
 
@@ -269,6 +292,15 @@ computeBCs(
 
     for (auto element = 0; element < elements_per_workset; ++element) {
 
+      auto const
+      box = box_lower.size();
+
+      box_lower.resize(box + coupled_dimension,
+          std::numeric_limits<double>::max());
+
+      box_upper.resize(box + coupled_dimension,
+          -std::numeric_limits<double>::max());
+
       for (auto node = 0; node < coupled_vertex_count; ++node) {
 
         auto const
@@ -278,155 +310,271 @@ computeBCs(
         local_node_id =
             coupled_overlap_node_map->getLocalElement(global_node_id);
 
-        double * const
-        pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
-
-        coupled_element_vertices[node].fill(pcoord);
+        element_vertex_ids.push_back(local_node_id);
 
         for (auto i = 0; i < coupled_dimension; ++i) {
-          coupled_element_solution[node](i) =
-              coupled_solution_view[coupled_dimension * local_node_id + i];
-        } // dimension loop
+          double const
+          x = coupled_coordinates[coupled_dimension * local_node_id + i];
 
-      } // node loop
-
-      bool
-      in_element = false;
+          box_lower[box + i] = std::min(box_lower[box + i], x - tolerance);
+          box_upper[box + i] = std::max(box_upper[box + i], x + tolerance);
+        }
 
-      switch (coupled_element_type) {
+      } // node loop
 
-      default:
-        std::cerr << "\nERROR: " << __PRETTY_FUNCTION__ << '\n';
-        std::cerr << "Unknown element type: " << coupled_element_type << '\n';
-        exit(1);
-        break;
+    } // element loop
 
-      case Intrepid2::ELEMENT::TETRAHEDRAL:
-        parametric_dimension = 3;
+  } // workset loop
 
-        basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_TET_C1_FEM<
-            double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>());
+  auto const
+  number_elements = element_vertex_ids.size() / coupled_vertex_count;
 
-        in_element = Intrepid2::in_tetrahedron(
-            point,
-            coupled_element_vertices[0],
-            coupled_element_vertices[1],
-            coupled_element_vertices[2],
-            coupled_element_vertices[3],
-            tolerance);
-        break;
+  BoxGrid
+  element_grid;
 
-      case Intrepid2::ELEMENT::HEXAHEDRAL:
-        parametric_dimension = 3;
-
-        basis = Teuchos::rcp(new Intrepid2::Basis_HGRAD_HEX_C1_FEM<
-            double, Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>>());
-
-        in_element = Intrepid2::in_hexahedron(
-            point,
-            coupled_element_vertices[0],
-            coupled_element_vertices[1],
-            coupled_element_vertices[2],
-            coupled_element_vertices[3],
-            coupled_element_vertices[4],
-            coupled_element_vertices[5],
-            coupled_element_vertices[6],
-            coupled_element_vertices[7],
-            tolerance);
-        break;
+  element_grid.build(coupled_dimension, box_lower, box_upper);
 
-      } // switch
+  std::vector<Intrepid2::Vector<double>>
+  coupled_element_vertices(coupled_vertex_count);
 
-      if (in_element == true) {
-        found = true;
-        break;
-      }
+  for (auto i = 0; i < coupled_vertex_count; ++i) {
+    coupled_element_vertices[i].set_dimension(coupled_dimension);
+  }
 
-    } // element loop
+  auto
+  gather_vertices = [&](int const element)
+  {
+    for (auto node = 0; node < coupled_vertex_count; ++node) {
+      auto const
+      local_node_id = element_vertex_ids[coupled_vertex_count * element + node];
 
-    if (found == true) {
-      break;
+      coupled_element_vertices[node].fill(
+          &(coupled_coordinates[coupled_dimension * local_node_id]));
     }
+  };
 
-  } // workset loop
+  auto
+  in_element = [&](Intrepid2::Vector<double> const & point)
+  {
+    switch (coupled_element_type) {
+
+    default:
+      return false;
+
+    case Intrepid2::ELEMENT::TETRAHEDRAL:
+      return Intrepid2::in_tetrahedron(
+          point,
+          coupled_element_vertices[0],
+          coupled_element_vertices[1],
+          coupled_element_vertices[2],
+          coupled_element_vertices[3],
+          tolerance);
+
+    case Intrepid2::ELEMENT::HEXAHEDRAL:
+      return Intrepid2::in_hexahedron(
+          point,
+          coupled_element_vertices[0],
+          coupled_element_vertices[1],
+          coupled_element_vertices[2],
+          coupled_element_vertices[3],
+          coupled_element_vertices[4],
+          coupled_element_vertices[5],
+          coupled_element_vertices[6],
+          coupled_element_vertices[7],
+          tolerance);
+
+    } // switch
+  };
 
-  assert(found == true);
+  auto const
+  number_points = ns_coord.size();
+
+  cached_dimension_ = coupled_dimension;
+  cached_vertex_count_ = coupled_vertex_count;
+  cached_vertex_ids_.resize(number_points * coupled_vertex_count);
+  cached_basis_values_.resize(number_points * coupled_vertex_count);
 
   // We do this element by element
   auto const
   number_cells = 1;
 
-  // Container for the parametric coordinates
+  auto const
+  number_points_per_cell = 1;
+
   Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>
   parametric_point(number_cells, parametric_dimension);
 
-  for (auto j = 0; j < parametric_dimension; ++j) {
-    parametric_point(0, j) = 0.0;
-  }
-
-  // Container for the physical point
   Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>
   physical_coordinates(number_cells, coupled_dimension);
 
-  for (auto i = 0; i < coupled_dimension; ++i) {
-    physical_coordinates(0, i) = point(i);
-  }
-
-  // Container for the physical nodal coordinates
-  // TODO: matToReference more general, accepts more topologies.
-  // Use it to find if point is contained in element as well.
   Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>
   nodal_coordinates(number_cells, coupled_vertex_count, coupled_dimension);
 
-  for (auto i = 0; i < coupled_vertex_count; ++i) {
-    for (auto j = 0; j < coupled_dimension; ++j) {
-      nodal_coordinates(0, i, j) = coupled_element_vertices[i](j);
+  Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>
+  basis_values(coupled_vertex_count, number_points_per_cell);
+
+  Intrepid2::Vector<double>
+  point;
+
+  point.set_dimension(coupled_dimension);
+
+  std::vector<int>
+  candidates;
+
+  for (auto ns_node = 0; ns_node < number_points; ++ns_node) {
+
+    point.fill(ns_coord[ns_node]);
+
+    // Determine the element that contains this point. Candidates come in
+    // workset and element order, so the first match is the one a linear
+    // search would find.
+    auto
+    containing_element = -1;
+
+    element_grid.find(ns_coord[ns_node], candidates);
+
+    for (auto candidate : candidates) {
+      gather_vertices(candidate);
+      if (in_element(point) == true) {
+        containing_element = candidate;
+        break;
+      }
     }
-  }
 
-  // Get parametric coordinates
-  Intrepid2::CellTools<double>::mapToReferenceFrame(
-      parametric_point,
-      physical_coordinates,
-      nodal_coordinates,
-      coupled_cell_topology,
-      0
-      );
+    // The tolerance may accept points just outside a grown bounding box
+    // near sharp element corners; fall back to a linear search for those.
+    for (auto element = 0;
+        containing_element < 0 && element < number_elements; ++element) {
+      gather_vertices(element);
+      if (in_element(point) == true) containing_element = element;
+    }
 
-  // Evaluate shape functions at parametric point.
-  auto const
-  number_points = 1;
+    TEUCHOS_TEST_FOR_EXCEPTION(containing_element < 0, std::runtime_error,
+        "Node set node " << ns_node << " at " << point <<
+        " is not inside any element of application " << coupled_app_name << '\n');
 
-  Intrepid2::FieldContainer_Kokkos<double, PHX::Layout, PHX::Device>
-  basis_values(coupled_vertex_count, number_points);
+    gather_vertices(containing_element);
 
-  basis->getValues(basis_values, parametric_point, Intrepid2::OPERATOR_VALUE);
+    // Get parametric coordinates
+    for (auto j = 0; j < parametric_dimension; ++j) {
+      parametric_point(0, j) = 0.0;
+    }
 
-  // Evaluate solution at parametric point using values of shape
-  // functions just computed.
-  Intrepid2::Vector<double>
-  value(coupled_dimension, Intrepid2::ZEROS);
+    for (auto i = 0; i < coupled_dimension; ++i) {
+      physical_coordinates(0, i) = point(i);
+    }
+
+    // TODO: matToReference more general, accepts more topologies.
+    // Use it to find if point is contained in element as well.
+    for (auto i = 0; i < coupled_vertex_count; ++i) {
+      for (auto j = 0; j < coupled_dimension; ++j) {
+        nodal_coordinates(0, i, j) = coupled_element_vertices[i](j);
+      }
+    }
+
+    Intrepid2::CellTools<double>::mapToReferenceFrame(
+        parametric_point,
+        physical_coordinates,
+        nodal_coordinates,
+        coupled_cell_topology,
+        0
+        );
+
+    // Evaluate shape functions at parametric point.
+    basis->getValues(basis_values, parametric_point, Intrepid2::OPERATOR_VALUE);
+
+    for (auto i = 0; i < coupled_vertex_count; ++i) {
+      cached_vertex_ids_[coupled_vertex_count * ns_node + i] =
+          element_vertex_ids[coupled_vertex_count * containing_element + i];
+
+      cached_basis_values_[coupled_vertex_count * ns_node + i] =
+          basis_values(i, 0);
+    }
 
 #if defined(DEBUG_LCM_SCHWARZ)
-  std::cout << "NODE   BASIS                     VALUE\n";
-  std::cout << "---------------------------------------------------------\n";
+    std::cout << "--------------------------------------------------------\n";
+    std::cout << "Current app      : " << this_app_name << '\n';
+    std::cout << "Coupling to app  : " << coupled_app_name << '\n';
+    std::cout << "Coupling to block: " << coupled_block_name << '\n';
+    std::cout << "Node set node    : " << ns_node << '\n';
+    std::cout << "Point            : " << point << '\n';
+    std::cout << "Element          : " << containing_element << '\n';
+    std::cout << "--------------------------------------------------------\n";
 #endif // DEBUG_LCM_SCHWARZ
 
-  for (auto i = 0; i < coupled_vertex_count; ++i) {
-    value += basis_values(i, 0) * coupled_element_solution[i];
+  } // node set node loop
+
+  cached_mesh_generation_ = coupled_stk_disc->getMeshGeneration();
+  cached_number_points_ = number_points;
+}
+
+//
+// Fetch the current coupled solution, and rebuild the point cache if the
+// coupled mesh changed. Called once before each loop over the node set.
+//
+template<typename EvalT, typename Traits>
+void
+SchwarzBC_Base<EvalT, Traits>::
+refreshCoupledSolution()
+{
+  if (isPointCacheCurrent() == false) buildPointCache();
+
+  Albany::Application const &
+  coupled_app = getApplication(getCoupledAppIndex());
+
+  auto *
+  coupled_stk_disc = static_cast<Albany::STKDiscretization *>(
+      coupled_app.getDiscretization().get());
+
+  coupled_solution_ = coupled_stk_disc->getSolutionFieldT();
+  coupled_solution_view_ = coupled_solution_->get1dView();
 
 #if defined(DEBUG_LCM_SCHWARZ)
-    std::cout << std::setw(4) << i << ' ';
-    std::cout << std::scientific << std::setw(24) << std::setprecision(16);
-    std::cout << basis_values(i, 0) << "    ";
-    std::cout << coupled_element_solution[i] << '\n';
-#endif // DEBUG_LCM_SCHWARZ
+  Teuchos::RCP<Teuchos::FancyOStream>
+  out = Teuchos::fancyOStream(Teuchos::VerboseObjectBase::getDefaultOStream());
+  *out << "coupled_solution: \n";
+  coupled_solution_->describe(*out, Teuchos::VERB_EXTREME);
+#endif //DEBUG_LCM_SCHWARZ
+}
+
+//
+//
+//
+template<typename EvalT, typename Traits>
+void
+SchwarzBC_Base<EvalT, Traits>::
+computeBCs(
+    size_t const ns_node,
+    ScalarT & x_val,
+    ScalarT & y_val,
+    ScalarT & z_val)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(coupled_solution_view_.is_null() == true,
+      std::logic_error,
+      "SchwarzBC: refreshCoupledSolution() must precede computeBCs()\n");
 
+  // Evaluate solution at the cached parametric point using the cached
+  // values of the shape functions.
+  Intrepid2::Vector<double>
+  value(cached_dimension_, Intrepid2::ZEROS);
+
+  for (auto i = 0; i < cached_vertex_count_; ++i) {
+    auto const
+    local_node_id = cached_vertex_ids_[cached_vertex_count_ * ns_node + i];
+
+    double const
+    basis_value = cached_basis_values_[cached_vertex_count_ * ns_node + i];
+
+    for (auto j = 0; j < cached_dimension_; ++j) {
+      value(j) += basis_value *
+          coupled_solution_view_[cached_dimension_ * local_node_id + j];
+    }
   }
 
 #if defined(DEBUG_LCM_SCHWARZ)
   std::cout << "--------------------------------------------------------\n";
-  std::cout << "RESULT : " << value << '\n';
+  std::cout << "Node set node : " << ns_node << '\n';
+  std::cout << "RESULT        : " << value << '\n';
   std::cout << "--------------------------------------------------------\n";
 #endif // DEBUG_LCM_SCHWARZ
 
@@ -714,6 +862,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
 
   } 
 #else // ALBANY_DTK
+  this->refreshCoupledSolution();
+
   for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
 
     ScalarT
@@ -783,6 +933,11 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   Teuchos::RCP<Tpetra_CrsMatrix>
   jacT = dirichlet_workset.JacT;
 
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      Teuchos::nonnull(dirichlet_workset.JacBlockT),
+      std::logic_error,
+      "SchwarzBC: not supported with Block CRS Jacobian storage." << '\n');
+
   Teuchos::RCP<const Tpetra_Vector>
   xT = dirichlet_workset.xT;
 
@@ -939,6 +1094,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       fT_view[z_dof] = xT_const_view[z_dof] - schwarz_bcs_const_view_z[dof];
     } 
 #else // ALBANY_DTK
+    this->refreshCoupledSolution();
+
     for (auto ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     
       auto const
@@ -1108,6 +1265,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       std::cout << "WARNING: fpT requested but unset when ALBANY_DTK is ON!\n";
     }
 #else  
+    this->refreshCoupledSolution();
+
     for (auto ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
 
       auto const
@@ -1289,6 +1448,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   int const
   nblock = x->size();
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1375,6 +1536,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   ScalarT
   x_val, y_val, z_val;
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1469,6 +1632,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   ScalarT
   x_val, y_val, z_val;
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1529,6 +1694,7 @@ template<typename Traits>
 void SchwarzBC<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichlet_workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector>
   f = dirichlet_workset.mp_f;
 
@@ -1554,6 +1720,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   int const
   nblock = x->size();
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1568,6 +1736,10 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       (*f)[block][z_dof] = (*x)[block][z_dof] - z_val.coeff(block);
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchwarzBC<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 //
@@ -1587,6 +1759,7 @@ template<typename Traits>
 void SchwarzBC<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichlet_workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector>
   f = dirichlet_workset.mp_f;
 
@@ -1640,6 +1813,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   ScalarT
   x_val, y_val, z_val;
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1677,6 +1852,10 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchwarzBC<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 //
@@ -1696,6 +1875,7 @@ template<typename Traits>
 void SchwarzBC<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichlet_workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector>
   f = dirichlet_workset.mp_f;
 
@@ -1733,6 +1913,8 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   ScalarT
   x_val, y_val, z_val;
 
+  this->refreshCoupledSolution();
+
   for (size_t ns_node = 0; ns_node < ns_nodes.size(); ++ns_node) {
     x_dof = ns_nodes[ns_node][0];
     y_dof = ns_nodes[ns_node][1];
@@ -1775,6 +1957,10 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
     }
 
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchwarzBC<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif // ALBANY_ENSEMBLE
 
@@ -113,6 +113,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "TorsionBC: not supported with Block CRS Jacobian storage." << std::endl);
 
  
   const RealType j_coeff = dirichletWorkset.j_coeff;
@@ -542,6 +544,7 @@ template<typename Traits>
 void TorsionBC<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x =
@@ -570,6 +573,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       (*f)[block][ylunk] = ((*x)[block][ylunk] - Yval.coeff(block));
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "TorsionBC<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -586,6 +593,7 @@ template<typename Traits>
 void TorsionBC<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix>> jac =
@@ -644,6 +652,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "TorsionBC<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -660,6 +672,7 @@ template<typename Traits>
 void TorsionBC<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> fp =
@@ -721,6 +734,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
     }
 
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "TorsionBC<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -47,6 +47,10 @@
 #include "J2MiniSolver.hpp"
 
 #include "../parallel_models/ParallelNeohookeanModel.hpp"
+#include "../parallel_models/ParallelJ2Model.hpp"
+#ifndef KOKKOS_HAVE_CUDA
+#  include "../parallel_models/ParallelGursonModel.hpp"
+#endif
 
 namespace LCM
 {
@@ -305,6 +309,8 @@ initializeModel(Teuchos::ParameterList* p,
     model = rcp(new CreepModel<EvalT, Traits>(p, dl));
   } else if (model_name == "J2") {
     model = rcp(new J2Model<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel J2") {
+    model = rcp(new ParallelJ2Model<EvalT, Traits>(p, dl));
   } else if (model_name == "Newtonian Fluid") {
     model = rcp(new NewtonianFluidModel<EvalT, Traits>(p, dl));
 #ifndef KOKKOS_HAVE_CUDA
@@ -320,6 +326,8 @@ initializeModel(Teuchos::ParameterList* p,
 #ifndef KOKKOS_HAVE_CUDA
   } else if (model_name == "Gurson") {
     model = rcp(new GursonModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel Gurson") {
+    model = rcp(new ParallelGursonModel<EvalT, Traits>(p, dl));
   } else if (model_name == "GursonHMR") {
     model = rcp(new GursonHMRModel<EvalT, Traits>(p, dl));
 #endif
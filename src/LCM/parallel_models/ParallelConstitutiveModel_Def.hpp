@@ -7,8 +7,8 @@
 #include <Kokkos_Core.hpp>
 #include "utility/PerformanceContext.hpp"
 #include "utility/TimeMonitor.hpp"
-#include "utility/TimeGuard.hpp"
 #include "utility/Memory.hpp"
+#include "Albany_WorksetColoring.hpp"
 
 namespace LCM
 {
@@ -33,20 +33,21 @@ computeState(
     std::map<std::string, Teuchos::RCP<PHX::MDField<ScalarT> > > dep_fields,
     std::map<std::string, Teuchos::RCP<PHX::MDField<ScalarT> > > eval_fields)
 {
-  util::TimeMonitor &tmonitor = util::PerformanceContext::instance().timeMonitor();
-  Teuchos::RCP<Teuchos::Time> kernel_time = tmonitor["Constitutive Model: Kernel Time"];
-  Teuchos::RCP<Teuchos::Time> transfer_time = tmonitor["Constitutive Model: Transfer Time"];
   kernel_->init(workset, dep_fields, eval_fields);
   
   // Data may be set using CUDA UVM so we need to synchronize
-  //transfer_time->start();
   Kokkos::fence();
-  util::TimeGuard total_time_guard( kernel_time );
-  //transfer_time->stop();
+
+  // The timers are shared by all fill threads and are not thread safe
+  Teuchos::RCP<Teuchos::Time> kernel_time;
+  if (!Albany::inParallelWorksetFill())
+    kernel_time = util::PerformanceContext::instance().timeMonitor()["Constitutive Model: Kernel Time"];
+  if (Teuchos::nonnull(kernel_time)) kernel_time->start();
   //Kokkos::parallel_for(workset.numCells, kern);
   Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>>(0,workset.numCells),
                         [this]( int cell ){ for (int pt = 0; pt < num_pts_; ++pt) {(*kernel_)(cell,pt);}});
   Kokkos::fence();
+  if (Teuchos::nonnull(kernel_time)) kernel_time->stop();
 }
 
 }
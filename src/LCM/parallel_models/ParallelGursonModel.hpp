@@ -0,0 +1,120 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelGursonModel_hpp)
+#define LCM_ParallelGursonModel_hpp
+
+#include <Intrepid2_MiniTensor.h>
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+
+namespace LCM
+{
+
+//! \brief Point kernel of GursonModel, same return mapping as the serial model
+template<typename EvalT, typename Traits>
+struct GursonKernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  GursonKernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  GursonKernel(const GursonKernel&) = delete;
+  GursonKernel& operator=(const GursonKernel&) = delete;
+
+  using ScalarT = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+  using DFadType = typename Sacado::mpl::apply<FadType, ScalarT>::type;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  // Dependent MDFields
+  ScalarField def_grad;
+  ScalarField J;
+  ScalarField poissons_ratio;
+  ScalarField elastic_modulus;
+  ScalarField yield_strength;
+  ScalarField hardening_modulus;
+
+  // Evaluated MDFields
+  ScalarField stress;
+  ScalarField Fp;
+  ScalarField eqps;
+  ScalarField void_volume;
+
+  // Old state
+  Albany::MDArray Fp_old;
+  Albany::MDArray eqps_old;
+  Albany::MDArray void_volume_old;
+
+  // Saturation hardening constants
+  RealType sat_mod_, sat_exp_;
+
+  // Initial Void Volume
+  RealType f0_;
+
+  // Shear Damage Parameter
+  RealType kw_;
+
+  // Void Nucleation Parameters
+  RealType eN_, sN_, fN_;
+
+  // Critical Void Parameters
+  RealType fc_, ff_;
+
+  // Yield Parameters
+  RealType q1_, q2_, q3_;
+
+  void init(Workset &workset,
+       FieldMap<ScalarT> &dep_fields,
+       FieldMap<ScalarT> &eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
+
+private:
+
+  ///
+  /// Compute Yield Function
+  ///
+  ScalarT
+  YieldFunction(Intrepid2::Tensor<ScalarT> const & s, ScalarT const & p,
+      ScalarT const & fvoid, ScalarT const & eq, ScalarT const & K,
+      ScalarT const & Y, ScalarT const & jacobian, ScalarT const & E) const;
+
+  ///
+  /// Compute Residual and Local Jacobian
+  ///
+  void
+  ResidualJacobian(std::vector<ScalarT> & X,
+      std::vector<ScalarT> & R, std::vector<ScalarT> & dRdX, const ScalarT & p,
+      const ScalarT & fvoid, const ScalarT & eq, Intrepid2::Tensor<ScalarT> & s,
+      const ScalarT & mu, const ScalarT & kappa, const ScalarT & K,
+      const ScalarT & Y, const ScalarT & jacobian) const;
+};
+
+template<typename EvalT, typename Traits>
+using ParallelGursonModel = LCM::ParallelConstitutiveModel<EvalT, Traits, GursonKernel<EvalT, Traits>>;
+
+}
+
+#endif
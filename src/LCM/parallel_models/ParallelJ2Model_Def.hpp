@@ -0,0 +1,289 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelJ2Model_Def_hpp)
+#define LCM_ParallelJ2Model_Def_hpp
+
+#include <Intrepid2_MiniTensor.h>
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+#include "LocalNonlinearSolver.hpp"
+
+namespace LCM
+{
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+J2Kernel<EvalT, Traits>::
+J2Kernel(ConstitutiveModel<EvalT, Traits> &model,
+    Teuchos::ParameterList* p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+  : BaseKernel(model),
+    sat_mod(p->get<RealType>("Saturation Modulus", 0.0)),
+    sat_exp(p->get<RealType>("Saturation Exponent", 0.0))
+{
+  // retrive appropriate field name strings
+  std::string cauchy_string = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string = field_name_map_["Fp"];
+  std::string eqps_string = field_name_map_["eqps"];
+  std::string yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string source_string = field_name_map_["Mechanical_Source"];
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+
+  // define the dependent fields
+  setDependentField(F_string, dl->qp_tensor);
+  setDependentField(J_string, dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+  setDependentField("Yield Strength", dl->qp_scalar);
+  setDependentField("Hardening Modulus", dl->qp_scalar);
+  setDependentField("Delta Time", dl->workset_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(Fp_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(yieldSurface_string, dl->qp_scalar);
+  if (have_temperature_) {
+    setEvaluatedField(source_string, dl->qp_scalar);
+  }
+
+  // define the state variables
+  //
+  // stress
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, false,
+      p->get<bool>("Output Cauchy Stress", false));
+  //
+  // Fp
+  addStateVariable(Fp_string, dl->qp_tensor, "identity", 0.0, true,
+      p->get<bool>("Output Fp", false));
+  //
+  // eqps
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true,
+      p->get<bool>("Output eqps", false));
+  //
+  // yield surface
+  addStateVariable(yieldSurface_string, dl->qp_scalar, "scalar", 0.0, false,
+      p->get<bool>("Output Yield Surface", false));
+  //
+  // mechanical source
+  if (have_temperature_) {
+    addStateVariable(source_string, dl->qp_scalar, "scalar", 0.0, false,
+        p->get<bool>("Output Mechanical Source", false));
+  }
+}
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+void
+J2Kernel<EvalT, Traits>::
+init(Workset &workset,
+     FieldMap<ScalarT> &dep_fields,
+     FieldMap<ScalarT> &eval_fields)
+{
+  std::string cauchy_string = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string = field_name_map_["Fp"];
+  std::string eqps_string = field_name_map_["eqps"];
+  std::string yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string source_string = field_name_map_["Mechanical_Source"];
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+
+  // extract dependent MDFields
+  def_grad = *dep_fields[F_string];
+  J = *dep_fields[J_string];
+  poissons_ratio = *dep_fields["Poissons Ratio"];
+  elastic_modulus = *dep_fields["Elastic Modulus"];
+  yieldStrength = *dep_fields["Yield Strength"];
+  hardeningModulus = *dep_fields["Hardening Modulus"];
+  delta_time = *dep_fields["Delta Time"];
+
+  // extract evaluated MDFields
+  stress = *eval_fields[cauchy_string];
+  Fp = *eval_fields[Fp_string];
+  eqps = *eval_fields[eqps_string];
+  yieldSurf = *eval_fields[yieldSurface_string];
+  if (have_temperature_) {
+    source = *eval_fields[source_string];
+  }
+
+  // get State Variables
+  Fpold = (*workset.stateArrayPtr)[Fp_string + "_old"];
+  eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+}
+
+//----------------------------------------------------------------------------
+// Same operations, in the same order, as J2Model::computeState so that the
+// parallel and serial models agree bit for bit.
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+J2Kernel<EvalT, Traits>::
+operator()(int cell, int pt) const
+{
+  constexpr Intrepid2::Index MAX_DIM{3};
+
+  ScalarT kappa, mu, mubar, K, Y;
+  ScalarT Jm23, smag, f, p, dgam;
+  ScalarT sq23(std::sqrt(2. / 3.));
+
+  Intrepid2::Tensor<ScalarT, MAX_DIM> F(num_dims_), be(num_dims_),
+      s(num_dims_), sigma(num_dims_);
+  Intrepid2::Tensor<ScalarT, MAX_DIM> N(num_dims_), A(num_dims_),
+      expA(num_dims_), Fpnew(num_dims_);
+  Intrepid2::Tensor<ScalarT, MAX_DIM> I(
+      Intrepid2::eye<ScalarT, MAX_DIM>(num_dims_));
+  Intrepid2::Tensor<ScalarT, MAX_DIM> Fpn(num_dims_), Fpinv(num_dims_),
+      Cpinv(num_dims_);
+
+  kappa = elastic_modulus(cell, pt)
+      / (3. * (1. - 2. * poissons_ratio(cell, pt)));
+  mu = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
+  K = hardeningModulus(cell, pt);
+  Y = yieldStrength(cell, pt);
+  Jm23 = std::pow(J(cell, pt), -2. / 3.);
+  // fill local tensors
+  F.fill(def_grad, cell, pt, 0, 0);
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      Fpn(i, j) = ScalarT(Fpold(cell, pt, i, j));
+    }
+  }
+
+  // compute trial state
+  Fpinv = Intrepid2::inverse(Fpn);
+
+  Cpinv = Fpinv * Intrepid2::transpose(Fpinv);
+  be = Jm23 * F * Cpinv * Intrepid2::transpose(F);
+  s = mu * Intrepid2::dev(be);
+
+  mubar = Intrepid2::trace(be) * mu / (num_dims_);
+
+  // check yield condition
+  smag = Intrepid2::norm(s);
+  f = smag - sq23 * (Y + K * eqpsold(cell, pt)
+      + sat_mod * (1. - std::exp(-sat_exp * eqpsold(cell, pt))));
+
+  if (f > 1E-12) {
+    // return mapping algorithm
+    bool converged = false;
+    ScalarT H = 0.0;
+    ScalarT dH = 0.0;
+    ScalarT alpha = 0.0;
+    ScalarT res = 0.0;
+    int count = 0;
+    dgam = 0.0;
+
+    int const
+    num_max_iter = 30;
+
+    LocalNonlinearSolver<EvalT, Traits> solver;
+
+    std::vector<ScalarT> R(1);
+    std::vector<ScalarT> dRdX(1);
+    std::vector<ScalarT> X(1);
+
+    R[0] = f;
+    X[0] = 0.0;
+
+    dRdX[0] = (-2. * mubar) * (1. + H / (3. * mubar));
+    while (!converged && count <= num_max_iter)
+    {
+      count++;
+      solver.solve(dRdX, X, R);
+      alpha = eqpsold(cell, pt) + sq23 * X[0];
+      H = K * alpha + sat_mod * (1. - exp(-sat_exp * alpha));
+      dH = K + sat_exp * sat_mod * exp(-sat_exp * alpha);
+      R[0] = smag - (2. * mubar * X[0] + sq23 * (Y + H));
+      dRdX[0] = -2. * mubar * (1. + dH / (3. * mubar));
+
+      res = std::abs(R[0]);
+      if (res < 1.e-11 || res / Y < 1.E-11 || res / f < 1.E-11)
+        converged = true;
+
+      TEUCHOS_TEST_FOR_EXCEPTION(count == num_max_iter, std::runtime_error,
+          std::endl <<
+          "Error in return mapping, count = " <<
+          count <<
+          "\nres = " << res <<
+          "\nrelres  = " << res/f <<
+          "\nrelres2 = " << res/Y <<
+          "\ng = " << R[0] <<
+          "\ndg = " << dRdX[0] <<
+          "\nalpha = " << alpha << std::endl);
+    }
+
+    solver.computeFadInfo(dRdX, X, R);
+    dgam = X[0];
+
+    // plastic direction
+    N = (1 / smag) * s;
+
+    // update s
+    s -= 2 * mubar * dgam * N;
+
+    // update eqps
+    eqps(cell, pt) = alpha;
+
+    // mechanical source
+    if (have_temperature_ && delta_time(0) > 0) {
+      source(cell, pt) = (sq23 * dgam / delta_time(0)
+        * (Y + H + temperature_(cell,pt))) / (density_ * heat_capacity_);
+    }
+
+    // exponential map to get Fpnew
+    A = dgam * N;
+    expA = Intrepid2::exp(A);
+    Fpnew = expA * Fpn;
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        Fp(cell, pt, i, j) = Fpnew(i, j);
+      }
+    }
+  } else {
+    eqps(cell, pt) = eqpsold(cell, pt);
+    if (have_temperature_) source(cell, pt) = 0.0;
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        Fp(cell, pt, i, j) = Fpn(i, j);
+      }
+    }
+  }
+
+  // update yield surface
+  yieldSurf(cell, pt) = Y + K * eqps(cell, pt)
+                       + sat_mod * (1. - std::exp(-sat_exp * eqps(cell, pt)));
+
+  // compute pressure
+  p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
+
+  // compute stress
+  sigma = p * I + s / J(cell, pt);
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      stress(cell, pt, i, j) = sigma(i, j);
+    }
+  }
+
+  // thermal correction, applied to the stored stress as in the serial model
+  if (have_temperature_) {
+    F.fill(def_grad, cell, pt, 0, 0);
+    ScalarT detF = Intrepid2::det(F);
+    sigma.fill(stress, cell, pt, 0, 0);
+    sigma -= 3.0 * expansion_coeff_ * (1.0 + 1.0 / (detF*detF))
+      * (temperature_(cell,pt) - ref_temperature_) * I;
+    for (int i = 0; i < num_dims_; ++i) {
+      for (int j = 0; j < num_dims_; ++j) {
+        stress(cell, pt, i, j) = sigma(i, j);
+      }
+    }
+  }
+}
+
+}
+
+#endif
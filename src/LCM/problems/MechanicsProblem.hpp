@@ -2450,7 +2450,8 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
     p->set<std::string>("Temperature Name", temperature);
     // FIXME: this creates a circular dependency between the constitutive model and transport
     // see below
-    if (material_model_name == "J2" || material_model_name == "Elasto Viscoplastic") {
+    if (material_model_name == "J2" || material_model_name == "Parallel J2" ||
+        material_model_name == "Elasto Viscoplastic") {
       p->set<std::string>("Equivalent Plastic Strain Name", eqps);
       p->set<std::string>("Strain Rate Factor Name", strainRateFactor);
     }
@@ -2821,7 +2822,8 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
     p->set<std::string>("Diffusivity Name", "Thermal Diffusivity");
 
     // Source
-    if ((have_mech_ || have_mech_eq_) && material_model_name == "J2") {
+    if ((have_mech_ || have_mech_eq_) &&
+        (material_model_name == "J2" || material_model_name == "Parallel J2")) {
       p->set<bool>("Have Source", true);
       p->set<std::string>("Source Name", mech_source);
     }
@@ -2857,7 +2859,8 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
     p->set<std::string>("Weighted Gradient BF Name", "wGrad BF");
     p->set<std::string>("Gradient BF Name", "Grad BF");
     if ((have_mech_ || have_mech_eq_) &&
-        (material_model_name == "J2" || material_model_name == "Elasto Viscoplastic")) {
+        (material_model_name == "J2" || material_model_name == "Parallel J2" ||
+         material_model_name == "Elasto Viscoplastic")) {
       p->set<std::string>("Equivalent Plastic Strain Name", eqps);
       p->set<std::string>("Strain Rate Factor Name", strainRateFactor);
     }
@@ -0,0 +1,122 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <BoxGrid.h>
+
+namespace
+{
+//
+// Boxes found by the grid must match a linear search.
+//
+TEST(BoxGrid, MatchesLinearSearch)
+{
+  int const
+  dimension{3};
+
+  int const
+  number_boxes{500};
+
+  std::srand(1);
+
+  auto
+  random = []() {return static_cast<double>(std::rand()) / RAND_MAX;};
+
+  std::vector<double>
+  lower(dimension * number_boxes);
+
+  std::vector<double>
+  upper(dimension * number_boxes);
+
+  for (auto b = 0; b < number_boxes; ++b) {
+    for (auto i = 0; i < dimension; ++i) {
+      lower[dimension * b + i] = 10.0 * random();
+      upper[dimension * b + i] = lower[dimension * b + i] + random();
+    }
+  }
+
+  LCM::BoxGrid
+  grid;
+
+  grid.build(dimension, lower, upper);
+
+  ASSERT_EQ(grid.getNumberBoxes(), number_boxes);
+
+  std::vector<int>
+  found;
+
+  for (auto p = 0; p < 1000; ++p) {
+    double
+    point[dimension];
+
+    for (auto i = 0; i < dimension; ++i) {
+      point[i] = 12.0 * random() - 1.0;
+    }
+
+    std::vector<int>
+    expected;
+
+    for (auto b = 0; b < number_boxes; ++b) {
+      bool
+      inside = true;
+
+      for (auto i = 0; i < dimension; ++i) {
+        if (point[i] < lower[dimension * b + i] ||
+            point[i] > upper[dimension * b + i]) inside = false;
+      }
+
+      if (inside == true) expected.push_back(b);
+    }
+
+    grid.find(point, found);
+
+    ASSERT_EQ(found, expected);
+  }
+}
+
+//
+// Degenerate extent in one direction.
+//
+TEST(BoxGrid, FlatBoxes)
+{
+  std::vector<double>
+  lower{0.0, 0.0, 1.0, 0.0};
+
+  std::vector<double>
+  upper{1.0, 0.0, 2.0, 0.0};
+
+  LCM::BoxGrid
+  grid;
+
+  grid.build(2, lower, upper);
+
+  std::vector<int>
+  found;
+
+  double const
+  point[2] = {1.0, 0.0};
+
+  grid.find(point, found);
+
+  ASSERT_EQ(found, std::vector<int>({0, 1}));
+
+  double const
+  outside[2] = {0.5, 0.1};
+
+  grid.find(outside, found);
+
+  ASSERT_EQ(found.size(), 0);
+}
+
+} // anonymous namespace
+
+int
+main(int ac, char * av[])
+{
+  ::testing::InitGoogleTest(&ac, av);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,555 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+//
+// Program for benchmarking material models in LCM
+// Reads in a material.xml file, as the Material Point Simulator does, and
+// times the constitutive model on batches of material points along its
+// loading path. Appends one CSV row per evaluation type and batch size.
+//
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_TestForException.hpp>
+#include <Phalanx.hpp>
+
+#include <PHAL_AlbanyTraits.hpp>
+#include <PHAL_SaveStateField.hpp>
+#include <Albany_Utils.hpp>
+#include <Albany_StateManager.hpp>
+#include <Albany_TmplSTKMeshStruct.hpp>
+#include <Albany_STKDiscretization.hpp>
+#include <Albany_Layouts.hpp>
+
+#include <Intrepid2_MiniTensor.h>
+
+#include "FieldNameMap.hpp"
+#include "SetField.hpp"
+#include "ConstitutiveModelInterface.hpp"
+#include "ConstitutiveModelParameters.hpp"
+#include "MaterialDatabase.h"
+
+#include "Kokkos_Core.hpp"
+
+#include "utility/PerformanceContext.hpp"
+#include "utility/TimeMonitor.hpp"
+
+struct KokkosGuard
+{
+  KokkosGuard( int ac, char* av[] )
+  {
+    Kokkos::initialize( ac, av );
+  }
+
+  ~KokkosGuard()
+  {
+    Kokkos::finalize();
+  }
+};
+
+bool TpetraBuild = false;
+
+namespace {
+
+typedef PHAL::AlbanyTraits Traits;
+typedef PHAL::AlbanyTraits::Residual Residual;
+typedef PHAL::AlbanyTraits::Jacobian Jacobian;
+
+#if defined(ALBANY_SFAD_SIZE)
+const int derivative_dimension = ALBANY_SFAD_SIZE;
+#else
+// As in a Hex8 mechanics element: 8 nodes x 3 displacements
+const int derivative_dimension = 24;
+#endif
+
+// Components of F seeded as independent variables for Jacobian
+const int num_seeded_components = 9;
+
+// Value of a field entry; for Jacobian, component k of F is seeded as
+// independent variable k
+template<typename EvalT>
+struct Seed {
+  static typename EvalT::ScalarT
+  value(const int k, const RealType v) { return v; }
+};
+
+template<>
+struct Seed<Jacobian> {
+  static FadType
+  value(const int k, const RealType v)
+  { return k < 0 ? FadType(v) : FadType(derivative_dimension, k, v); }
+};
+
+struct BenchmarkResult {
+  double seconds;
+  double newton_iterations;  // per point and step, < 0 if not reported
+  double state_bytes;        // per point
+};
+
+struct LoadPath {
+  std::string load_case;
+  int number_steps;
+  double step_size;
+  Intrepid2::Tensor<RealType> log_F;
+  bool have_temperature;
+  double temperature;
+  std::string iteration_field_name;
+};
+
+// Kokkos takes the thread count from the command line
+int kokkosThreads(int ac, char* av[])
+{
+  for (int i = 1; i < ac; ++i) {
+    const char* arg = av[i];
+    for (const char* prefix : {"--kokkos-threads=", "--threads="})
+      if (std::strncmp(arg, prefix, std::strlen(prefix)) == 0)
+        return std::atoi(arg + std::strlen(prefix));
+  }
+  return 1;
+}
+
+template<typename T>
+std::vector<T> parseList(const std::string& list)
+{
+  std::vector<T> values;
+  std::stringstream ss(list);
+  std::string item;
+  while (std::getline(ss, item, ','))
+    if (item.length() > 0) {
+      std::stringstream is(item);
+      T value;
+      is >> value;
+      values.push_back(value);
+    }
+  return values;
+}
+
+// Registers the SetField evaluators for the kinematic inputs of the model
+template<typename EvalT>
+void registerInputs(PHX::FieldManager<Traits>& fm,
+                    const Teuchos::RCP<Albany::Layouts>& dl,
+                    const bool have_temperature,
+                    Teuchos::ArrayRCP<typename EvalT::ScalarT>& def_grad,
+                    Teuchos::ArrayRCP<typename EvalT::ScalarT>& det_def_grad,
+                    Teuchos::ArrayRCP<typename EvalT::ScalarT>& strain,
+                    Teuchos::ArrayRCP<typename EvalT::ScalarT>& temperature,
+                    Teuchos::ArrayRCP<typename EvalT::ScalarT>& delta_time)
+{
+  const char* names[] = {"F", "J", "Strain", "Temperature", "Delta Time"};
+  const Teuchos::RCP<PHX::DataLayout> layouts[] = {
+    dl->qp_tensor, dl->qp_scalar, dl->qp_tensor, dl->qp_scalar, dl->workset_scalar};
+  Teuchos::ArrayRCP<typename EvalT::ScalarT>* values[] = {
+    &def_grad, &det_def_grad, &strain, &temperature, &delta_time};
+
+  for (int f = 0; f < 5; ++f) {
+    if (f == 3 && !have_temperature) continue;
+    Teuchos::ParameterList p(std::string("SetField") + names[f]);
+    p.set<std::string>("Evaluated Field Name", names[f]);
+    p.set<Teuchos::RCP<PHX::DataLayout>>("Evaluated Field Data Layout", layouts[f]);
+    p.set<Teuchos::ArrayRCP<typename EvalT::ScalarT>>("Field Values", *values[f]);
+    fm.template registerEvaluator<EvalT>(
+      Teuchos::rcp(new LCM::SetField<EvalT, Traits>(p)));
+  }
+}
+
+// Sets the inputs of every point to the loading path at alpha in [0,1]
+template<typename EvalT>
+void setInputs(const LoadPath& path,
+               const double alpha,
+               Teuchos::ArrayRCP<typename EvalT::ScalarT>& def_grad,
+               Teuchos::ArrayRCP<typename EvalT::ScalarT>& det_def_grad,
+               Teuchos::ArrayRCP<typename EvalT::ScalarT>& strain,
+               Teuchos::ArrayRCP<typename EvalT::ScalarT>& temperature)
+{
+  const Intrepid2::Tensor<RealType> F = Intrepid2::exp(alpha * path.log_F);
+  const Intrepid2::Tensor<RealType> eps =
+    0.5 * (F + Intrepid2::transpose(F)) - Intrepid2::eye<RealType>(3);
+  const RealType J = Intrepid2::det(F);
+
+  for (int pt = 0; pt < det_def_grad.size(); ++pt) {
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j) {
+        def_grad[9 * pt + 3 * i + j] = Seed<EvalT>::value(3 * i + j, F(i, j));
+        strain[9 * pt + 3 * i + j] = Seed<EvalT>::value(-1, eps(i, j));
+      }
+    det_def_grad[pt] = Seed<EvalT>::value(-1, J);
+    if (path.have_temperature)
+      temperature[pt] = Seed<EvalT>::value(-1, path.temperature);
+  }
+}
+
+// Times the model of materialName for EvalT on workset_size cells of
+// num_pts points. The states are advanced by a separate Residual field
+// manager after each step, which is not timed.
+template<typename EvalT>
+BenchmarkResult
+runBenchmark(const Teuchos::RCP<LCM::MaterialDatabase>& material_db,
+             const Teuchos::RCP<const Teuchos_Comm>& commT,
+             const LoadPath& path,
+             const int workset_size,
+             const int num_pts)
+{
+  typedef typename EvalT::ScalarT ScalarT;
+
+  const std::string element_block_name = "Block0";
+  const int num_dims = 3;
+  const int num_vertices = 8;
+  const int num_nodes = 8;
+  const Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(
+      new Albany::Layouts(workset_size, num_vertices, num_nodes, num_pts, num_dims));
+
+  std::string matName = material_db->getElementBlockParam<std::string>(
+      element_block_name, "material");
+  Teuchos::ParameterList& paramList = material_db->getElementBlockSublist(
+      element_block_name, matName);
+  paramList.set<bool>("Compute Tangent", false);
+
+  LCM::FieldNameMap field_name_map(false);
+  paramList.set<Teuchos::RCP<std::map<std::string, std::string>>>(
+      "Name Map", field_name_map.getMap());
+  if (path.have_temperature)
+    paramList.set<bool>("Have Temperature", true);
+
+  const int num_points = workset_size * num_pts;
+
+  // Inputs of the timed field manager and of the state field manager
+  Teuchos::ArrayRCP<ScalarT> def_grad(9 * num_points), det_def_grad(num_points),
+    strain(9 * num_points), temperature(num_points), delta_time(1);
+  Teuchos::ArrayRCP<RealType> r_def_grad(9 * num_points), r_det_def_grad(num_points),
+    r_strain(9 * num_points), r_temperature(num_points), r_delta_time(1);
+  delta_time[0] = path.step_size;
+  r_delta_time[0] = path.step_size;
+
+  PHX::FieldManager<Traits> fieldManager;
+  PHX::FieldManager<Traits> stateFieldManager;
+
+  registerInputs<EvalT>(fieldManager, dl, path.have_temperature,
+                        def_grad, det_def_grad, strain, temperature, delta_time);
+  registerInputs<Residual>(stateFieldManager, dl, path.have_temperature,
+                           r_def_grad, r_det_def_grad, r_strain, r_temperature, r_delta_time);
+
+  Teuchos::ParameterList cmpPL;
+  cmpPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
+  Teuchos::ParameterList cmiPL;
+  cmiPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
+  if (path.have_temperature) {
+    cmpPL.set<std::string>("Temperature Name", "Temperature");
+    cmiPL.set<std::string>("Temperature Name", "Temperature");
+  }
+
+  fieldManager.template registerEvaluator<EvalT>(Teuchos::rcp(
+      new LCM::ConstitutiveModelParameters<EvalT, Traits>(cmpPL, dl)));
+  Teuchos::RCP<LCM::ConstitutiveModelInterface<EvalT, Traits>> CMI = Teuchos::rcp(
+      new LCM::ConstitutiveModelInterface<EvalT, Traits>(cmiPL, dl));
+  fieldManager.template registerEvaluator<EvalT>(CMI);
+  for (std::vector<Teuchos::RCP<PHX::FieldTag>>::const_iterator it =
+         CMI->evaluatedFields().begin(); it != CMI->evaluatedFields().end(); ++it)
+    fieldManager.template requireField<EvalT>(**it);
+
+  stateFieldManager.registerEvaluator<Residual>(Teuchos::rcp(
+      new LCM::ConstitutiveModelParameters<Residual, Traits>(cmpPL, dl)));
+  Teuchos::RCP<LCM::ConstitutiveModelInterface<Residual, Traits>> stateCMI = Teuchos::rcp(
+      new LCM::ConstitutiveModelInterface<Residual, Traits>(cmiPL, dl));
+  stateFieldManager.registerEvaluator<Residual>(stateCMI);
+
+  // Register the state variables, and count the bytes they take per point,
+  // including the old copy of the states that keep one
+  Albany::StateManager stateMgr;
+  BenchmarkResult result;
+  result.state_bytes = 0.0;
+  for (int sv(0); sv < stateCMI->getNumStateVars(); ++sv) {
+    stateCMI->fillStateVariableStruct(sv);
+    Teuchos::RCP<Teuchos::ParameterList> p = stateMgr.registerStateVariable(
+        stateCMI->getName(),
+        stateCMI->getLayout(),
+        dl->dummy,
+        element_block_name,
+        stateCMI->getInitType(),
+        stateCMI->getInitValue(),
+        stateCMI->getStateFlag(),
+        stateCMI->getOutputFlag());
+    stateFieldManager.registerEvaluator<Residual>(
+        Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p)));
+    result.state_bytes += (stateCMI->getStateFlag() ? 2.0 : 1.0) * sizeof(RealType) *
+      stateCMI->getLayout()->size() / num_points;
+  }
+
+  if (Teuchos::is_same<EvalT, Jacobian>::value) {
+    std::vector<PHX::index_size_type> derivative_dimensions(1, derivative_dimension);
+    fieldManager.template setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+  }
+  fieldManager.template postRegistrationSetupForType<EvalT>("");
+
+  Teuchos::RCP<PHX::DataLayout> dummy = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  std::vector<std::string> responseIDs =
+    stateMgr.getResidResponseIDsToRequire(element_block_name);
+  for (std::vector<std::string>::const_iterator it = responseIDs.begin();
+       it != responseIDs.end(); it++) {
+    PHX::Tag<Residual::ScalarT> res_response_tag(*it, dummy);
+    stateFieldManager.requireField<Residual>(res_response_tag);
+  }
+  stateFieldManager.postRegistrationSetupForType<Residual>("");
+
+  // Discretization, as required by the StateManager
+  Teuchos::RCP<Teuchos::ParameterList> discretizationParameterList =
+      Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<int>("Workset Size", workset_size);
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  Teuchos::RCP<Albany::GenericSTKMeshStruct> stkMeshStruct = Teuchos::rcp(
+      new Albany::TmplSTKMeshStruct<3>(discretizationParameterList, Teuchos::null, commT));
+  stkMeshStruct->setFieldAndBulkData(
+      commT,
+      discretizationParameterList,
+      num_dims,
+      req,
+      stateMgr.getStateInfoStruct(),
+      stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization = Teuchos::rcp(
+      new Albany::STKDiscretization(stkMeshStruct, commT));
+  discretization->updateMesh();
+  stateMgr.setStateArrays(discretization);
+
+  PHAL::Workset workset;
+  workset.numCells = workset_size;
+  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  // Models that count their local Newton iterations per point name the
+  // field in "Iteration Field Name"
+  const std::string& iteration_field_name = path.iteration_field_name;
+  PHX::MDField<ScalarT, Cell, QuadPoint> iterations(
+      iteration_field_name.length() > 0 ? iteration_field_name : "unused",
+      dl->qp_scalar);
+  double total_iterations = 0.0;
+
+  util::TimeMonitor &tmonitor = util::PerformanceContext::instance().timeMonitor();
+  std::stringstream timer_name;
+  timer_name << "MPB: " << PHX::typeAsString<EvalT>() << " " << workset_size;
+  Teuchos::RCP<Teuchos::Time> compute_time = tmonitor[timer_name.str()];
+  const double start_time = compute_time->totalElapsedTime();
+
+  for (int istep(0); istep <= path.number_steps; ++istep) {
+    const double alpha = double(istep) / path.number_steps;
+    setInputs<EvalT>(path, alpha, def_grad, det_def_grad, strain, temperature);
+    setInputs<Residual>(path, alpha, r_def_grad, r_det_def_grad, r_strain, r_temperature);
+
+    compute_time->start();
+    fieldManager.template preEvaluate<EvalT>(workset);
+    fieldManager.template evaluateFields<EvalT>(workset);
+    fieldManager.template postEvaluate<EvalT>(workset);
+    compute_time->stop();
+
+    if (iteration_field_name.length() > 0) {
+      fieldManager.template getFieldData<ScalarT, EvalT, Cell, QuadPoint>(iterations);
+      for (int cell = 0; cell < workset_size; ++cell)
+        for (int pt = 0; pt < num_pts; ++pt)
+          total_iterations += Sacado::ScalarValue<ScalarT>::eval(iterations(cell, pt));
+    }
+
+    stateFieldManager.preEvaluate<Residual>(workset);
+    stateFieldManager.evaluateFields<Residual>(workset);
+    stateFieldManager.postEvaluate<Residual>(workset);
+    stateMgr.updateStates();
+  }
+
+  result.seconds = compute_time->totalElapsedTime() - start_time;
+  result.newton_iterations = iteration_field_name.length() > 0 ?
+    total_iterations / (double(num_points) * (path.number_steps + 1)) : -1.0;
+  return result;
+}
+
+} // namespace
+
+int main(int ac, char* av[])
+{
+  KokkosGuard kokkos( ac, av );
+
+  //
+  // Create a command line processor and parse command line options
+  //
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString("Material Point Benchmark.\n"
+      "Times the material models in LCM on batches of material points.\n"
+      "Run with --kokkos-threads=N to set the number of threads.\n");
+
+  std::string input_file = "materials.xml";
+  command_line_processor.setOption("input", &input_file, "Input File Name");
+
+  std::string summary_file = "benchmark.csv";
+  command_line_processor.setOption("summary", &summary_file,
+      "Summary File Name, to which the results are appended");
+
+  std::string timing_file = "timing.csv";
+  command_line_processor.setOption("timing", &timing_file, "Timing File Name");
+
+  std::string batch_sizes = "1,16,256";
+  command_line_processor.setOption("batches", &batch_sizes,
+      "Comma separated workset sizes (cells per batch)");
+
+  std::string eval_types = "Residual,Jacobian";
+  command_line_processor.setOption("eval", &eval_types,
+      "Comma separated evaluation types: Residual, Jacobian");
+
+  int num_pts = 8;
+  command_line_processor.setOption("npoints", &num_pts, "Number of Gaussian Points per cell");
+
+  std::string iteration_field_name = "";
+  command_line_processor.setOption("iterations", &iteration_field_name,
+      "Field counting the local Newton iterations of each point "
+      "(default: Iteration Field Name in the input file)");
+
+  int number_steps = 0;
+  command_line_processor.setOption("steps", &number_steps,
+      "Number of load steps (0 = as in the input file)");
+
+  // Throw a warning and not error for unrecognized options
+  command_line_processor.recogniseAllOptions(true);
+
+  // Don't throw exceptions for errors
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+      command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+  Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  Teuchos::RCP<LCM::MaterialDatabase> material_db =
+    Teuchos::rcp(new LCM::MaterialDatabase(input_file, commT));
+
+  const std::string element_block_name = "Block0";
+  const std::string material_model_name = material_db->getElementBlockSublist(
+      element_block_name,
+      "Material Model").get<std::string>("Model Name");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      material_model_name.length() == 0,
+      std::logic_error,
+      "A material model must be defined for block: " + element_block_name);
+
+  std::string matName = material_db->getElementBlockParam<std::string>(
+      element_block_name, "material");
+  Teuchos::ParameterList& mpsParams = material_db->getElementBlockSublist(
+      element_block_name, matName).sublist("Material Point Simulator");
+
+  // The loading path of the Material Point Simulator
+  LoadPath path;
+  path.load_case = mpsParams.get<std::string>("Loading Case Name", "uniaxial");
+  path.number_steps = number_steps > 0 ? number_steps :
+    mpsParams.get<int>("Number of Steps", 10);
+  path.step_size = mpsParams.get<double>("Step Size", 1.0e-2);
+  path.have_temperature = mpsParams.get<bool>("Use Temperature", false);
+  path.temperature = mpsParams.get<double>("Temperature", 1.0);
+  path.iteration_field_name = iteration_field_name.length() > 0 ?
+    iteration_field_name : mpsParams.get<std::string>("Iteration Field Name", "");
+
+  std::vector<RealType> F_vector(9, 0.0);
+  const double stretch = path.number_steps * path.step_size;
+  if (path.load_case == "uniaxial") {
+    F_vector[0] = 1.0 + stretch;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (path.load_case == "simple-shear") {
+    F_vector[0] = 1.0;
+    F_vector[1] = stretch;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (path.load_case == "hydrostatic") {
+    F_vector[0] = 1.0 + stretch;
+    F_vector[4] = 1.0 + stretch;
+    F_vector[8] = 1.0 + stretch;
+  } else if (path.load_case == "general") {
+    F_vector = mpsParams.get<Teuchos::Array<double>>(
+        "Deformation Gradient Components").toVector();
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true,
+        std::runtime_error,
+        "Improper Loading Case in Material Point Simulator block");
+  }
+  path.log_F = Intrepid2::log(Intrepid2::Tensor<RealType>(3, &F_vector[0]));
+
+  const int threads = kokkosThreads(ac, av);
+
+  // Machine-readable summary, one row per evaluation type and batch size
+  bool write_header;
+  {
+    std::ifstream existing(summary_file.c_str());
+    write_header = !existing.good() ||
+      existing.peek() == std::ifstream::traits_type::eof();
+  }
+  std::ofstream summary(summary_file.c_str(), std::ios::app);
+  if (write_header)
+    summary << "model,eval_type,threads,batch_size,points_per_cell,steps,points,"
+            << "seconds,points_per_second,newton_iterations_per_point,"
+            << "state_bytes_per_point" << std::endl;
+  summary.precision(6);
+
+  const std::vector<std::string> evals = parseList<std::string>(eval_types);
+  const std::vector<int> batches = parseList<int>(batch_sizes);
+  for (std::size_t e = 0; e < evals.size(); ++e) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        evals[e] != "Residual" && evals[e] != "Jacobian",
+        std::logic_error,
+        "Unknown evaluation type " << evals[e] << ": use Residual or Jacobian");
+    // A fixed-size Fad type with fewer derivatives than the components of F
+    // cannot carry the seeds
+    if (evals[e] == "Jacobian" &&
+        derivative_dimension < num_seeded_components) {
+      std::cout << "Skipping Jacobian: the derivative dimension "
+                << derivative_dimension << " is below the "
+                << num_seeded_components << " seeded components of F"
+                << std::endl;
+      continue;
+    }
+    for (std::size_t b = 0; b < batches.size(); ++b) {
+      const BenchmarkResult result = (evals[e] == "Residual") ?
+        runBenchmark<Residual>(material_db, commT, path, batches[b], num_pts) :
+        runBenchmark<Jacobian>(material_db, commT, path, batches[b], num_pts);
+
+      const double points =
+        double(batches[b]) * num_pts * (path.number_steps + 1);
+      std::cout << material_model_name << " " << evals[e]
+                << ": batch " << batches[b] << ", " << threads << " threads, "
+                << points / result.seconds << " points/s" << std::endl;
+
+      summary << "\"" << material_model_name << "\"," << evals[e] << ","
+              << threads << "," << batches[b] << "," << num_pts << ","
+              << path.number_steps + 1 << "," << points << ","
+              << result.seconds << "," << points / result.seconds << ",";
+      if (result.newton_iterations >= 0.0)
+        summary << result.newton_iterations;
+      summary << "," << result.state_bytes << std::endl;
+    }
+  }
+  summary.close();
+
+  std::ofstream tout( timing_file.c_str() );
+  if ( tout ) {
+    util::PerformanceContext::instance().timeMonitor().summarize( tout );
+    tout.close();
+  }
+}
@@ -0,0 +1,209 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "BoxGrid.h"
+
+namespace LCM {
+
+//
+//
+//
+BoxGrid::
+BoxGrid() :
+    dimension_(0)
+{
+  for (auto i = 0; i < 3; ++i) {
+    origin_[i] = 0.0;
+    spacing_[i] = 1.0;
+    cells_[i] = 1;
+  }
+}
+
+//
+//
+//
+void
+BoxGrid::
+build(
+    int const dimension,
+    std::vector<double> const & lower,
+    std::vector<double> const & upper)
+{
+  assert(1 <= dimension && dimension <= 3);
+  assert(lower.size() == upper.size());
+
+  dimension_ = dimension;
+  lower_ = lower;
+  upper_ = upper;
+
+  auto const
+  number_boxes = getNumberBoxes();
+
+  for (auto i = 0; i < 3; ++i) {
+    origin_[i] = 0.0;
+    spacing_[i] = 1.0;
+    cells_[i] = 1;
+  }
+
+  cell_start_.assign(2, 0);
+  cell_boxes_.clear();
+
+  if (number_boxes == 0) return;
+
+  // Bounds of all boxes.
+  double
+  max_corner[3];
+
+  for (auto i = 0; i < dimension_; ++i) {
+    origin_[i] = std::numeric_limits<double>::max();
+    max_corner[i] = -std::numeric_limits<double>::max();
+  }
+
+  for (auto b = 0; b < number_boxes; ++b) {
+    for (auto i = 0; i < dimension_; ++i) {
+      origin_[i] = std::min(origin_[i], lower_[dimension_ * b + i]);
+      max_corner[i] = std::max(max_corner[i], upper_[dimension_ * b + i]);
+    }
+  }
+
+  // About one box per cell.
+  int const
+  cells_per_direction = std::max(1, static_cast<int>(
+      std::ceil(std::pow(static_cast<double>(number_boxes), 1.0 / dimension_))));
+
+  auto
+  number_cells = 1;
+
+  for (auto i = 0; i < dimension_; ++i) {
+    double const
+    extent = max_corner[i] - origin_[i];
+
+    cells_[i] = extent > 0.0 ? cells_per_direction : 1;
+    spacing_[i] = extent > 0.0 ? extent / cells_[i] : 1.0;
+    number_cells *= cells_[i];
+  }
+
+  // Two passes: count the boxes per cell, then fill.
+  cell_start_.assign(number_cells + 1, 0);
+
+  int
+  first[3] = {0, 0, 0};
+
+  int
+  last[3] = {0, 0, 0};
+
+  for (auto pass = 0; pass < 2; ++pass) {
+
+    std::vector<int>
+    position(cell_start_.begin(), cell_start_.end() - 1);
+
+    for (auto b = 0; b < number_boxes; ++b) {
+
+      for (auto i = 0; i < dimension_; ++i) {
+        first[i] = cellIndex(lower_[dimension_ * b + i], i);
+        last[i] = cellIndex(upper_[dimension_ * b + i], i);
+      }
+
+      for (auto k = first[2]; k <= last[2]; ++k) {
+        for (auto j = first[1]; j <= last[1]; ++j) {
+          for (auto i = first[0]; i <= last[0]; ++i) {
+
+            auto const
+            cell = (k * cells_[1] + j) * cells_[0] + i;
+
+            if (pass == 0) {
+              ++cell_start_[cell + 1];
+            } else {
+              cell_boxes_[position[cell]++] = b;
+            }
+          }
+        }
+      }
+    } // box loop
+
+    if (pass == 0) {
+      for (auto c = 0; c < number_cells; ++c) {
+        cell_start_[c + 1] += cell_start_[c];
+      }
+      cell_boxes_.resize(cell_start_[number_cells]);
+    }
+  } // pass loop
+}
+
+//
+//
+//
+void
+BoxGrid::
+find(double const * const point, std::vector<int> & boxes) const
+{
+  boxes.clear();
+
+  if (getNumberBoxes() == 0) return;
+
+  auto
+  cell = 0;
+
+  for (auto i = dimension_ - 1; i >= 0; --i) {
+    double const
+    x = point[i];
+
+    if (x < origin_[i] || x > origin_[i] + cells_[i] * spacing_[i]) return;
+
+    cell = cell * cells_[i] + cellIndex(x, i);
+  }
+
+  for (auto n = cell_start_[cell]; n < cell_start_[cell + 1]; ++n) {
+
+    auto const
+    b = cell_boxes_[n];
+
+    bool
+    inside = true;
+
+    for (auto i = 0; i < dimension_; ++i) {
+      double const
+      x = point[i];
+
+      if (x < lower_[dimension_ * b + i] || x > upper_[dimension_ * b + i]) {
+        inside = false;
+        break;
+      }
+    }
+
+    if (inside == true) boxes.push_back(b);
+  }
+}
+
+//
+//
+//
+int
+BoxGrid::
+getNumberBoxes() const
+{
+  return dimension_ > 0 ? lower_.size() / dimension_ : 0;
+}
+
+//
+//
+//
+int
+BoxGrid::
+cellIndex(double const x, int const i) const
+{
+  int const
+  c = static_cast<int>(std::floor((x - origin_[i]) / spacing_[i]));
+
+  return std::min(std::max(c, 0), cells_[i] - 1);
+}
+
+} // namespace LCM
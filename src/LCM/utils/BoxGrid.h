@@ -0,0 +1,78 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_BoxGrid_h)
+#define LCM_BoxGrid_h
+
+#include <vector>
+
+namespace LCM {
+
+///
+/// Uniform grid over a set of axis-aligned boxes, for locating the boxes
+/// (typically element bounding boxes) that contain a point without
+/// visiting every box. Each grid cell lists the boxes that overlap it.
+///
+class BoxGrid
+{
+public:
+
+  BoxGrid();
+
+  ///
+  /// Box b spans [lower[dimension * b + i], upper[dimension * b + i]]
+  /// in direction i.
+  ///
+  void
+  build(
+      int const dimension,
+      std::vector<double> const & lower,
+      std::vector<double> const & upper);
+
+  ///
+  /// Indices, in ascending order, of the boxes that contain the point.
+  ///
+  void
+  find(double const * const point, std::vector<int> & boxes) const;
+
+  int
+  getNumberBoxes() const;
+
+private:
+
+  int
+  cellIndex(double const x, int const i) const;
+
+  int
+  dimension_;
+
+  std::vector<double>
+  lower_;
+
+  std::vector<double>
+  upper_;
+
+  double
+  origin_[3];
+
+  double
+  spacing_[3];
+
+  int
+  cells_[3];
+
+  // Boxes overlapping grid cell c are
+  // cell_boxes_[cell_start_[c] .. cell_start_[c + 1]).
+  std::vector<int>
+  cell_start_;
+
+  std::vector<int>
+  cell_boxes_;
+};
+
+} // namespace LCM
+
+#endif // LCM_BoxGrid_h
@@ -93,6 +93,24 @@ RCP<EpetraExt::ModelEvaluator> ReducedOrderModelFactory::create(const RCP<Epetra
   return result;
 }
 
+RCP<const Teuchos::Array<int> > ReducedOrderModelFactory::getSampleMeshDofs()
+{
+  RCP<const Teuchos::Array<int> > result;
+
+  if (useReducedOrderModel()) {
+    const RCP<ParameterList> romParams = extractReducedOrderModelParams(params_);
+    const bool useSampleMesh = sublist(romParams, "Hyper Reduction")->get("Sample Mesh Evaluation", false);
+    if (useSampleMesh) {
+      result = spaceFactory_->getSampleDofs(romParams);
+      TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(result),
+                                 std::logic_error,
+                                 "Sample Mesh Evaluation requires an active Hyper Reduction");
+    }
+  }
+
+  return result;
+}
+
 bool ReducedOrderModelFactory::useReducedOrderModel() const
 {
   return extractReducedOrderModelParams(params_)->get("Activate", false);
@@ -10,6 +10,7 @@
 
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
+#include "Teuchos_Array.hpp"
 
 class Epetra_MultiVector;
 class Epetra_Map;
@@ -26,6 +27,10 @@ public:
 
   Teuchos::RCP<EpetraExt::ModelEvaluator> create(const Teuchos::RCP<EpetraExt::ModelEvaluator> &child);
 
+  // Entries of the state the full-order model must evaluate exactly: the
+  // collocation sample when "Sample Mesh Evaluation" is requested, else null
+  Teuchos::RCP<const Teuchos::Array<int> > getSampleMeshDofs();
+
 private:
   Teuchos::RCP<ReducedSpaceFactory> spaceFactory_;
   Teuchos::RCP<Teuchos::ParameterList> params_;
@@ -88,6 +88,17 @@ ReducedSpaceFactory::getSamplingOperator(
     const Epetra_Map &stateMap)
 {
   Teuchos::RCP<const Epetra_Operator> result;
+  const Teuchos::RCP<const Teuchos::Array<int> > sampleLocalEntries = this->getSampleDofs(params);
+  if (Teuchos::nonnull(sampleLocalEntries)) {
+    result = Teuchos::rcp(new EpetraSamplingOperator(stateMap, *sampleLocalEntries));
+  }
+  return result;
+}
+
+Teuchos::RCP<const Teuchos::Array<int> >
+ReducedSpaceFactory::getSampleDofs(const Teuchos::RCP<Teuchos::ParameterList> &params)
+{
+  Teuchos::RCP<const Teuchos::Array<int> > result;
   {
     const Teuchos::RCP<Teuchos::ParameterList> hyperreductionParams = Teuchos::sublist(params, "Hyper Reduction");
     const bool useHyperreduction = hyperreductionParams->get("Activate", false);
@@ -99,8 +110,7 @@ ReducedSpaceFactory::getSamplingOperator(
           hyperreductionType + " not in " + allowedHyperreductionTypes.toString());
       if (hyperreductionType == allowedHyperreductionTypes[0]) {
         const Teuchos::RCP<Teuchos::ParameterList> collocationParams = Teuchos::sublist(hyperreductionParams, "Collocation Data");
-        const Teuchos::Array<int> sampleLocalEntries = samplingFactory_->create(collocationParams);
-        result = Teuchos::rcp(new EpetraSamplingOperator(stateMap, sampleLocalEntries));
+        result = Teuchos::rcp(new Teuchos::Array<int>(samplingFactory_->create(collocationParams)));
       } else {
         TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "Should not happen");
       }
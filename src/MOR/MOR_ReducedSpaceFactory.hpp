@@ -10,6 +10,7 @@
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_Array.hpp"
 
 #include <string>
 #include <map>
@@ -39,6 +40,10 @@ public:
       const Teuchos::RCP<Teuchos::ParameterList> &params,
       const Epetra_Map &stateMap);
 
+  // Local ids of the collocation entries, null without hyper-reduction
+  Teuchos::RCP<const Teuchos::Array<int> > getSampleDofs(
+      const Teuchos::RCP<Teuchos::ParameterList> &params);
+
 private:
   ReducedBasisRepository basisRepository_;
   Teuchos::RCP<SampleDofListFactory> samplingFactory_;
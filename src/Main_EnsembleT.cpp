@@ -0,0 +1,165 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Sampling driver for the Tpetra ensemble fill: evaluates the residual and
+// Jacobian of ALBANY_ENSEMBLE_SIZE samples of one parameter in a single
+// MPResidual/MPJacobian fill, and checks them against one Residual/Jacobian
+// fill per sample. Returns the number of samples that do not match.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "Albany_Utils.hpp"
+#include "Albany_SolverFactory.hpp"
+#include "Albany_Application.hpp"
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_StandardCatchMacros.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+#include "Kokkos_Core.hpp"
+
+// Global variable that denotes this is the Tpetra executable
+bool TpetraBuild = true;
+
+namespace {
+
+//! Largest entry-wise difference of two matrices on the same graph.
+ST maxEntryDifference(const Tpetra_CrsMatrix& a, const Tpetra_CrsMatrix& b)
+{
+  ST diff = 0.0;
+  Teuchos::ArrayView<const LO> aIndices, bIndices;
+  Teuchos::ArrayView<const ST> aValues, bValues;
+  for (LO row = 0; row < a.getNodeNumRows(); ++row) {
+    a.getLocalRowView(row, aIndices, aValues);
+    b.getLocalRowView(row, bIndices, bValues);
+    for (int k = 0; k < aValues.size(); ++k)
+      diff = std::max(diff, std::abs(aValues[k] - bValues[k]));
+  }
+  ST globalDiff;
+  Teuchos::reduceAll(*a.getComm(), Teuchos::REDUCE_MAX, diff,
+                     Teuchos::outArg(globalDiff));
+  return globalDiff;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+  int status=0; // 0 = pass, failures are incremented
+  bool success = true;
+
+  Teuchos::GlobalMPISession mpiSession(&argc,&argv);
+  Kokkos::initialize(argc, argv);
+
+  using Teuchos::RCP;
+  using Teuchos::rcp;
+
+  RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
+
+  // Command-line argument for input file
+  Albany::CmdLineArgs cmd("inputEnsembleT.xml");
+  cmd.parse_cmdline(argc, argv, *out);
+
+  try {
+    RCP<const Teuchos_Comm> comm =
+      Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+
+    Albany::SolverFactory slvrfctry(cmd.xml_filename, comm);
+    RCP<Albany::Application> app;
+    slvrfctry.createAndGetAlbanyAppT(app, comm, comm);
+
+    Teuchos::ParameterList& ensembleParams =
+      slvrfctry.getParameters().sublist("Ensemble");
+    const std::string paramName = ensembleParams.get<std::string>("Parameter");
+    const double lower = ensembleParams.get<double>("Lower Bound");
+    const double upper = ensembleParams.get<double>("Upper Bound");
+    const double tol = ensembleParams.get("Relative Tolerance", 1.0e-12);
+
+    // Samples evenly spaced over [lower, upper], one per ensemble entry
+    const int nsamples = ALBANY_ENSEMBLE_SIZE;
+    Teuchos::Array<double> samples(nsamples);
+    for (int i = 0; i < nsamples; ++i)
+      samples[i] = nsamples > 1 ?
+        lower + i*(upper - lower)/(nsamples - 1) : lower;
+
+    Teuchos::Array<ParamVec> p(1);
+    app->getParamLib()->fillVector<PHAL::AlbanyTraits::Residual>(
+      Teuchos::Array<std::string>(1, paramName), p[0]);
+    Teuchos::Array<int> mp_p_index(1, 0);
+    Teuchos::Array< Teuchos::Array<MPType> > mp_p_vals(1, Teuchos::Array<MPType>(1));
+    for (int i = 0; i < nsamples; ++i)
+      mp_p_vals[0][0].fastAccessCoeff(i) = samples[i];
+
+    // Every sample is evaluated at the initial guess
+    RCP<const Tpetra_Map> mapT = app->getMapT();
+    RCP<const Tpetra_CrsGraph> graphT = app->getJacobianGraphT();
+    RCP<const Tpetra_Vector> x0T =
+      app->getAdaptSolMgrT()->getInitialSolution()->getVector(0);
+    const Tpetra_Vector& xT = *x0T;
+    Tpetra_MultiVector mp_xT(mapT, nsamples);
+    for (int i = 0; i < nsamples; ++i)
+      mp_xT.getVectorNonConst(i)->assign(xT);
+
+    *out << "\nEnsemble of " << nsamples << " samples of \"" << paramName
+         << "\" in [" << lower << ", " << upper << "]" << std::endl;
+
+    // Ensemble fill
+    Tpetra_MultiVector mp_fT(mapT, nsamples);
+    Teuchos::Array<RCP<Tpetra_CrsMatrix> > mp_jacT(nsamples);
+    for (int i = 0; i < nsamples; ++i)
+      mp_jacT[i] = rcp(new Tpetra_CrsMatrix(graphT));
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("AlbanyEnsembleT: Ensemble Fill");
+      app->computeGlobalEnsembleResidualT(0.0, NULL, NULL, mp_xT, p,
+                                          mp_p_index, mp_p_vals, mp_fT);
+      app->computeGlobalEnsembleJacobianT(0.0, 1.0, 0.0, 0.0, NULL, NULL, mp_xT, p,
+                                          mp_p_index, mp_p_vals, NULL, mp_jacT);
+    }
+
+    // One fill per sample
+    Tpetra_Vector fT(mapT);
+    Tpetra_CrsMatrix jacT(graphT);
+    for (int i = 0; i < nsamples; ++i) {
+      p[0][0].baseValue = samples[i];
+      {
+        TEUCHOS_FUNC_TIME_MONITOR("AlbanyEnsembleT: Sample Fills");
+        app->computeGlobalResidualT(0.0, NULL, NULL, xT, p, fT);
+        app->computeGlobalJacobianT(0.0, 1.0, 0.0, 0.0, NULL, NULL, xT, p, NULL, jacT);
+      }
+
+      const ST fNorm = fT.norm2();
+      fT.update(-1.0, *mp_fT.getVector(i), 1.0);
+      const ST fDiff = fT.norm2();
+      const ST jacNorm = jacT.getFrobeniusNorm();
+      const ST jacDiff = maxEntryDifference(jacT, *mp_jacT[i]);
+
+      const bool match = fDiff <= tol*std::max(fNorm, 1.0) &&
+                         jacDiff <= tol*std::max(jacNorm, 1.0);
+      *out << "  sample " << i << " (" << samples[i] << "): |f - f_mp| = "
+           << fDiff << ", max|J - J_mp| = " << jacDiff
+           << (match ? "" : "  MISMATCH") << std::endl;
+      if (!match) ++status;
+    }
+
+    if (mpiSession.getRank() > 0) status = 0;
+    else *out << "\nNumber of Failed Comparisons: " << status << std::endl;
+  }
+  TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
+  if (!success) status+=10000;
+
+  Teuchos::TimeMonitor::summarize(*out,false,true,false/*zero timers*/);
+
+  Kokkos::finalize_all();
+
+  return status;
+}
@@ -128,10 +128,16 @@ int main(int argc, char *argv[]) {
   int status=0; // 0 = pass, failures are incremented
   bool success = true;
 
+  // Command-line argument for input file
+  Albany::CmdLineArgs cmd;
+  cmd.parse_cmdline(argc, argv, std::cout);
+
+  // The asynchronous Exodus writer calls MPI from its own thread
+  const bool mpiThreads = Albany::requestsAsyncOutput(cmd.xml_filename);
 #ifdef ALBANY_DEBUG
-  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Albany::MPISession mpiSession(&argc, &argv, mpiThreads);
 #else // bypass printing process startup info
-  Teuchos::GlobalMPISession mpiSession(&argc, &argv, NULL);
+  Albany::MPISession mpiSession(&argc, &argv, mpiThreads, NULL);
 #endif
 
   Kokkos::initialize();
@@ -153,10 +159,6 @@ int main(int argc, char *argv[]) {
 
   RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
 
-  // Command-line argument for input file
-  Albany::CmdLineArgs cmd;
-  cmd.parse_cmdline(argc, argv, *out);
-
   try {
 
     RCP<Teuchos::Time> totalTime =
@@ -11,6 +11,7 @@
 #include "Albany_Utils.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_Memory.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #include "Piro_PerformSolve.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -222,7 +223,13 @@ int main(int argc, char *argv[]) {
   int status=0; // 0 = pass, failures are incremented
   bool success = true;
 
-  Teuchos::GlobalMPISession mpiSession(&argc,&argv);
+  // Command-line argument for input file
+  Albany::CmdLineArgs cmd;
+  cmd.parse_cmdline(argc, argv, std::cout);
+
+  // The asynchronous Exodus writer calls MPI from its own thread
+  Albany::MPISession mpiSession(&argc, &argv,
+                                Albany::requestsAsyncOutput(cmd.xml_filename));
   Kokkos::initialize(argc, argv);
 
 #ifdef ALBANY_FLUSH_DENORMALS
@@ -256,10 +263,6 @@ int main(int argc, char *argv[]) {
 
   RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
 
-  // Command-line argument for input file
-  Albany::CmdLineArgs cmd;
-  cmd.parse_cmdline(argc, argv, *out);
-
   try {
     RCP<Teuchos::Time> totalTime =
       Teuchos::TimeMonitor::getNewTimer("Albany: ***Total Time***");
@@ -278,6 +281,9 @@ int main(int argc, char *argv[]) {
     }
 
     Albany::SolverFactory slvrfctry(cmd.xml_filename, comm);
+    util::PerformanceContext::instance().setEnabled(
+      slvrfctry.getParameters().sublist("Debug Output").get<bool>(
+        "Hot Path Profiling", false));
     RCP<Albany::Application> app;
     const RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > solver =
       slvrfctry.createAndGetAlbanyAppT(app, comm, comm);
@@ -293,6 +299,10 @@ int main(int argc, char *argv[]) {
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Thyra::MultiVectorBase<ST> > > > thyraSensitivities;
     Piro::PerformSolve(*solver, solveParams, thyraResponses, thyraSensitivities);
 
+    // Report a failed asynchronous Exodus step here rather than at teardown
+    if (Teuchos::nonnull(app))
+      app->getDiscretization()->flushOutput();
+
     Teuchos::Array<Teuchos::RCP<const Tpetra_Vector> > responses;
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Tpetra_MultiVector> > > sensitivities;
 
@@ -479,6 +489,15 @@ int main(int argc, char *argv[]) {
     if (debugParams.get<bool>("Analyze Memory", false))
       Albany::printMemoryAnalysis(std::cout, comm);
 
+    // Per-rank min/avg/max of the hot-path regions; collective.
+    if (util::PerformanceContext::instance().isEnabled()) {
+      util::PerformanceContext::instance().summarizeAll(comm.ptr(), *out);
+      const std::string profileFile =
+        debugParams.get<std::string>("Hot Path Profile JSON File", "");
+      if (!profileFile.empty())
+        util::PerformanceContext::instance().writeJSON(comm.ptr(), profileFile);
+    }
+
     if (writeToMatrixMarketSoln == true) { 
 
       //create serial map that puts the whole solution on processor 0
@@ -96,6 +96,12 @@ struct Workset {
   Teuchos::RCP<const Stokhos::ProductEpetraVector > mp_xdotdot;
 #endif
 #endif
+#ifdef ALBANY_ENSEMBLE
+  //Tpetra ensemble fill: one column per sample; used instead of mp_x etc. when set
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xT;
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xdotT;
+  Teuchos::RCP<const Tpetra_MultiVector> mp_xdotdotT;
+#endif
 
 #if defined(ALBANY_EPETRA)
   // These are residual related.
@@ -110,6 +116,12 @@ struct Workset {
   //Tpetra analog of Jac
   Teuchos::RCP<Tpetra_CrsMatrix> JacT;
 
+  //Block analog of JacT, used instead of JacT with Block CRS Jacobian storage
+  Teuchos::RCP<Tpetra_BlockCrsMatrix> JacBlockT;
+
+  //Positions of the element entries in the values of JacT, if cached
+  Teuchos::RCP<const Albany::JacobianAssemblyPlan> jacAssemblyPlan;
+
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Epetra_MultiVector> JV;
   Teuchos::RCP<Epetra_MultiVector> fp;
@@ -137,6 +149,11 @@ struct Workset {
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > mp_JV;
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > mp_fp;
 #endif
+#endif
+#ifdef ALBANY_ENSEMBLE
+  //Tpetra analogs of mp_f and mp_Jac
+  Teuchos::RCP<Tpetra_MultiVector> mp_fT;
+  Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> > mp_JacT;
 #endif
 
   Teuchos::RCP<const Albany::NodeSetList> nodeSets;
@@ -169,7 +186,8 @@ struct Workset {
   bool transpose_dist_param_deriv;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> > > local_Vp;
 
-  Kokkos::View<int***, PHX::Device> wsElNodeEqID_kokkos;
+  //! Contiguous (cell, node, eq) -> unkLID
+  Albany::WsElNodeEqIDView wsElNodeEqID_kokkos;
   std::vector<PHX::index_size_type> Jacobian_deriv_dims;
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
@@ -937,6 +937,7 @@ template<typename Traits>
 void PoissonSourceInterface<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateInterfaceContribution(workset);
@@ -958,6 +959,10 @@ evaluateFields(typename Traits::EvalData workset)
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceInterface<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -976,6 +981,7 @@ template<typename Traits>
 void PoissonSourceInterface<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateInterfaceContribution(workset);
@@ -1036,6 +1042,10 @@ evaluateFields(typename Traits::EvalData workset)
         } // has fast access
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceInterface<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -1054,6 +1064,7 @@ template<typename Traits>
 void PoissonSourceInterface<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateInterfaceContribution(workset);
@@ -1101,6 +1112,10 @@ evaluateFields(typename Traits::EvalData workset)
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceInterface<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
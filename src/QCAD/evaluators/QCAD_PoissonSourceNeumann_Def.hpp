@@ -901,6 +901,7 @@ template<typename Traits>
 void PoissonSourceNeumann<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateNeumannContribution(workset);
@@ -925,6 +926,10 @@ evaluateFields(typename Traits::EvalData workset)
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceNeumann<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -943,6 +948,7 @@ template<typename Traits>
 void PoissonSourceNeumann<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateNeumannContribution(workset);
@@ -1005,6 +1011,10 @@ evaluateFields(typename Traits::EvalData workset)
         } // has fast access
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceNeumann<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -1023,6 +1033,7 @@ template<typename Traits>
 void PoissonSourceNeumann<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateNeumannContribution(workset);
@@ -1073,6 +1084,10 @@ evaluateFields(typename Traits::EvalData workset)
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "PoissonSourceNeumann<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -94,6 +94,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "SchrodingerDirichlet: not supported with Block CRS Jacobian storage." << std::endl);
 
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
@@ -391,6 +393,7 @@ template<typename Traits>
 void SchrodingerDirichlet<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f = 
     dirichletWorkset.mp_f;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x = 
@@ -404,6 +407,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       for (int block=0; block<nblock; block++)
 	(*f)[block][lunk] = ((*x)[block][lunk] - this->value.coeff(block));
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchrodingerDirichlet<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -421,7 +428,7 @@ template<typename Traits>
 void SchrodingerDirichlet<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f = 
     dirichletWorkset.mp_f;
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > jac = 
@@ -457,6 +464,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 	    (*x)[block][lunk] - this->value.val().coeff(block);
       }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchrodingerDirichlet<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -474,7 +485,7 @@ template<typename Traits>
 void SchrodingerDirichlet<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f = 
     dirichletWorkset.mp_f;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> fp = 
@@ -509,6 +520,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 	  (*fp)[block][i][lunk] = 
 	    -this->value.dx(dirichletWorkset.param_offset+i).coeff(block);
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SchrodingerDirichlet<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
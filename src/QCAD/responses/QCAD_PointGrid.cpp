@@ -0,0 +1,118 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cmath>
+
+#include "QCAD_PointGrid.hpp"
+
+QCAD::PointGrid::PointGrid()
+  : dims(0), nPts(0)
+{
+  for(int k=0; k<3; k++) {
+    origin[k] = 0.0; spacing[k] = 1.0; nCells[k] = 1;
+  }
+}
+
+void QCAD::PointGrid::
+build(const std::vector<double>& coords_, int nDims, double cellSize)
+{
+  dims = std::min(nDims, 3);
+  nPts = (nDims > 0) ? coords_.size() / nDims : 0;
+  coords.resize(nPts*dims);
+  for(std::size_t i=0; i<nPts; i++)
+    for(int k=0; k<dims; k++)
+      coords[i*dims+k] = coords_[i*nDims+k];
+
+  for(int k=0; k<3; k++) {
+    origin[k] = 0.0; spacing[k] = 1.0; nCells[k] = 1;
+  }
+  cellStart.assign(2, 0);
+  cellPts.clear();
+  if(nPts == 0) return;
+
+  double maxCorner[3];
+  for(int k=0; k<dims; k++) {
+    origin[k] = maxCorner[k] = coords[k];
+    for(std::size_t i=1; i<nPts; i++) {
+      origin[k] = std::min(origin[k], coords[i*dims+k]);
+      maxCorner[k] = std::max(maxCorner[k], coords[i*dims+k]);
+    }
+  }
+
+  // Cells of side cellSize, coarsened until there are at most a few per point
+  double h = (cellSize > 0) ? cellSize : 1.0;
+  const double maxCells = 4.0*nPts + 64;
+  while(true) {
+    double count = 1.0;
+    for(int k=0; k<dims; k++)
+      count *= std::floor((maxCorner[k] - origin[k]) / h) + 1;
+    if(count <= maxCells) break;
+    h *= 2;
+  }
+
+  std::size_t totalCells = 1;
+  for(int k=0; k<dims; k++) {
+    nCells[k] = static_cast<int>(std::floor((maxCorner[k] - origin[k]) / h)) + 1;
+    spacing[k] = h;
+    totalCells *= nCells[k];
+  }
+
+  // Two passes: count the points per cell, then fill
+  std::vector<int> pointCell(nPts);
+  cellStart.assign(totalCells+1, 0);
+  for(std::size_t i=0; i<nPts; i++) {
+    int c = 0;
+    for(int k=dims-1; k>=0; k--)
+      c = c*nCells[k] + cellIndex(coords[i*dims+k], k);
+    pointCell[i] = c;
+    cellStart[c+1]++;
+  }
+  for(std::size_t c=0; c<totalCells; c++)
+    cellStart[c+1] += cellStart[c];
+
+  cellPts.resize(nPts);
+  std::vector<int> pos(cellStart.begin(), cellStart.end()-1);
+  for(std::size_t i=0; i<nPts; i++)
+    cellPts[pos[pointCell[i]]++] = i;
+}
+
+void QCAD::PointGrid::
+findInBox(const double* p, double radius, std::vector<int>& pts) const
+{
+  pts.clear();
+  if(nPts == 0) return;
+
+  int first[3] = {0,0,0}, last[3] = {0,0,0};
+  for(int k=0; k<dims; k++) {
+    if(p[k] + radius < origin[k] || p[k] - radius > origin[k] + nCells[k]*spacing[k]) return;
+    first[k] = cellIndex(p[k] - radius, k);
+    last[k] = cellIndex(p[k] + radius, k);
+  }
+
+  for(int c2=first[2]; c2<=last[2]; c2++) {
+    for(int c1=first[1]; c1<=last[1]; c1++) {
+      for(int c0=first[0]; c0<=last[0]; c0++) {
+        const int c = (c2*nCells[1] + c1)*nCells[0] + c0;
+        for(int n=cellStart[c]; n<cellStart[c+1]; n++) {
+          const int i = cellPts[n];
+          bool inside = true;
+          for(int k=0; k<dims && inside; k++)
+            inside = (std::fabs(coords[i*dims+k] - p[k]) <= radius);
+          if(inside) pts.push_back(i);
+        }
+      }
+    }
+  }
+  std::sort(pts.begin(), pts.end());
+}
+
+int QCAD::PointGrid::
+cellIndex(double x, int k) const
+{
+  const int c = static_cast<int>(std::floor((x - origin[k]) / spacing[k]));
+  return std::min(std::max(c, 0), nCells[k]-1);
+}
@@ -0,0 +1,49 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef QCAD_POINTGRID_HPP
+#define QCAD_POINTGRID_HPP
+
+#include <vector>
+
+namespace QCAD {
+
+  // Uniform bucket grid over a fixed set of points, for finding the points
+  // near a given location without visiting all of them.
+  class PointGrid
+  {
+  public:
+    PointGrid();
+
+    // Point i has coordinates coords[i*nDims + k], k < nDims (at most 3).
+    // cellSize is a hint, typically the usual query radius; it is
+    // enlarged if needed so the grid has O(number of points) cells.
+    void build(const std::vector<double>& coords, int nDims, double cellSize);
+
+    // Indices, in ascending order, of the points p' with |p'[k] - p[k]| <= radius
+    // for every k: a superset of the points within distance radius of p.
+    void findInBox(const double* p, double radius, std::vector<int>& pts) const;
+
+    std::size_t size() const { return nPts; }
+
+  private:
+    int cellIndex(double x, int k) const;
+
+    int dims;
+    std::size_t nPts;
+    std::vector<double> coords;
+
+    double origin[3], spacing[3];
+    int nCells[3];
+
+    // Points in grid cell c are cellPts[cellStart[c] .. cellStart[c+1])
+    std::vector<int> cellStart;
+    std::vector<int> cellPts;
+  };
+
+}
+
+#endif // QCAD_POINTGRID_HPP
@@ -13,7 +13,10 @@
 #include "Tpetra_DistObject.hpp"
 #include "Tpetra_Map.hpp"
 #include "QCAD_GreensFunctionTunneling.hpp"
+#include "QCAD_PointGrid.hpp"
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include "Petra_Converters.hpp" 
 
 //! Helper function prototypes
@@ -401,6 +404,7 @@ initializeImagePoints(const double current_time,
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
 				    current_time, xdotT.get(), NULL, *xT, p, *gT);
     //No MPI here - each proc only holds all of it's worksets -- not other procs worksets
+    buildCachedPointGrid();
   }
 
 
@@ -546,6 +550,7 @@ initializeImagePointsT(const double current_time,
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
 				    current_time, xdotT, NULL, xT, p, gT);
     //No MPI here - each proc only holds all of it's worksets -- not other procs worksets
+    buildCachedPointGrid();
   }
 }
 
@@ -1566,11 +1571,23 @@ FindSaddlePoint_LevelSet(std::vector<double>& allFieldVals,
   std::vector<int> treeIDs(N, -1);
   std::vector<double> minFieldVals; //for each tree
   std::vector<int> treeSizes; //for each tree
+  std::vector<std::vector<int> > treeMembers; //for each tree
   int nextAvailableTreeID = 0;
 
+  // Bucket grid over the points, so the "close" points of I are found
+  //  without walking the whole field-value window of the sorted list
+  std::vector<double> flatCoords(N*numDims);
+  for(std::size_t i=0; i < N; i++)
+    for(std::size_t k=0; k < numDims; k++) flatCoords[i*numDims+k] = allCoords[k][i];
+  QCAD::PointGrid grid;
+  grid.build(flatCoords, numDims, cutoffDistance);
+
+  std::vector<int> rank(N), nearPts, nearRanks;
+  for(std::size_t i=0; i < N; i++) rank[ordering[i]] = i;
+
   int nTrees = 0, nMaxTrees = 0;
   int nDeepTrees=0, lastDeepTrees=0, treeIDtoReplace;
-  int I, J, K;
+  int I, J;
   for(std::size_t i=0; i < N; i++) {
     I = ordering[i];
 
@@ -1591,13 +1608,24 @@ FindSaddlePoint_LevelSet(std::vector<double>& allFieldVals,
       lastDeepTrees = nDeepTrees;
     }
 
-    for(int j=i-1; j >= 0 && fabs(allFieldVals[I] - allFieldVals[ordering[j]]) < cutoffFieldVal; j--) {
-      J = ordering[j];
+    // Visit the earlier points within the field cutoff, from the latest
+    //  backward, as a walk back through the sorted list would
+    grid.findInBox(&flatCoords[I*numDims], cutoffDistance, nearPts);
+    nearRanks.clear();
+    for(std::size_t n=0; n < nearPts.size(); n++) {
+      if(rank[nearPts[n]] < (int)i && fabs(allFieldVals[I] - allFieldVals[nearPts[n]]) < cutoffFieldVal)
+	nearRanks.push_back(rank[nearPts[n]]);
+    }
+    std::sort(nearRanks.begin(), nearRanks.end(), std::greater<int>());
+
+    for(std::size_t n=0; n < nearRanks.size(); n++) {
+      J = ordering[nearRanks[n]];
 
       if( QCAD::distance(allCoords, I, J, numDims) < cutoffDistance ) {
 	if(treeIDs[I] == -1) {
 	  treeIDs[I] = treeIDs[J];
 	  treeSizes[treeIDs[I]]++;
+	  treeMembers[treeIDs[I]].push_back(I);
 
 	  if(dbMode > 3) std::cout << " --> tree " << treeIDs[J] 
 			       << " ( size=" << treeSizes[treeIDs[J]] << ", depth=" 
@@ -1622,13 +1650,13 @@ FindSaddlePoint_LevelSet(std::vector<double>& allFieldVals,
 	  if( minFieldVals[treeIDtoReplace] < minFieldVals[treeIDs[J]] )
 	    minFieldVals[treeIDs[J]] = minFieldVals[treeIDtoReplace];
 
-	  for(int k=i; k >=0; k--) {
-	    K = ordering[k];
-	    if(treeIDs[K] == treeIDtoReplace) {
-	      treeIDs[K] = treeIDs[J];
-	      treeSizes[treeIDs[J]]++;
-	    }
+	  std::vector<int>& replaced = treeMembers[treeIDtoReplace];
+	  for(std::size_t k=0; k < replaced.size(); k++) {
+	    treeIDs[replaced[k]] = treeIDs[J];
+	    treeSizes[treeIDs[J]]++;
 	  }
+	  treeMembers[treeIDs[J]].insert(treeMembers[treeIDs[J]].end(), replaced.begin(), replaced.end());
+	  replaced.clear();
 	  treeSizes[treeIDtoReplace] = 0;
 	  nTrees -= 1;
 
@@ -1670,6 +1698,7 @@ FindSaddlePoint_LevelSet(std::vector<double>& allFieldVals,
       treeIDs[I] = nextAvailableTreeID++;
       minFieldVals.push_back(allFieldVals[I]);
       treeSizes.push_back(1);
+      treeMembers.push_back(std::vector<int>(1, I));
 
       nTrees += 1;
       if(nTrees > nMaxTrees) nMaxTrees = nTrees;
@@ -1710,11 +1739,23 @@ FindSaddlePoint_LevelSetT(std::vector<double>& allFieldVals,
   std::vector<int> treeIDs(N, -1);
   std::vector<double> minFieldVals; //for each tree
   std::vector<int> treeSizes; //for each tree
+  std::vector<std::vector<int> > treeMembers; //for each tree
   int nextAvailableTreeID = 0;
 
+  // Bucket grid over the points, so the "close" points of I are found
+  //  without walking the whole field-value window of the sorted list
+  std::vector<double> flatCoords(N*numDims);
+  for(std::size_t i=0; i < N; i++)
+    for(std::size_t k=0; k < numDims; k++) flatCoords[i*numDims+k] = allCoords[k][i];
+  QCAD::PointGrid grid;
+  grid.build(flatCoords, numDims, cutoffDistance);
+
+  std::vector<int> rank(N), nearPts, nearRanks;
+  for(std::size_t i=0; i < N; i++) rank[ordering[i]] = i;
+
   int nTrees = 0, nMaxTrees = 0;
   int nDeepTrees=0, lastDeepTrees=0, treeIDtoReplace;
-  int I, J, K;
+  int I, J;
   for(std::size_t i=0; i < N; i++) {
     I = ordering[i];
 
@@ -1735,13 +1776,24 @@ FindSaddlePoint_LevelSetT(std::vector<double>& allFieldVals,
       lastDeepTrees = nDeepTrees;
     }
 
-    for(int j=i-1; j >= 0 && fabs(allFieldVals[I] - allFieldVals[ordering[j]]) < cutoffFieldVal; j--) {
-      J = ordering[j];
+    // Visit the earlier points within the field cutoff, from the latest
+    //  backward, as a walk back through the sorted list would
+    grid.findInBox(&flatCoords[I*numDims], cutoffDistance, nearPts);
+    nearRanks.clear();
+    for(std::size_t n=0; n < nearPts.size(); n++) {
+      if(rank[nearPts[n]] < (int)i && fabs(allFieldVals[I] - allFieldVals[nearPts[n]]) < cutoffFieldVal)
+	nearRanks.push_back(rank[nearPts[n]]);
+    }
+    std::sort(nearRanks.begin(), nearRanks.end(), std::greater<int>());
+
+    for(std::size_t n=0; n < nearRanks.size(); n++) {
+      J = ordering[nearRanks[n]];
 
       if( QCAD::distance(allCoords, I, J, numDims) < cutoffDistance ) {
 	if(treeIDs[I] == -1) {
 	  treeIDs[I] = treeIDs[J];
 	  treeSizes[treeIDs[I]]++;
+	  treeMembers[treeIDs[I]].push_back(I);
 
 	  if(dbMode > 3) std::cout << " --> tree " << treeIDs[J] 
 			       << " ( size=" << treeSizes[treeIDs[J]] << ", depth=" 
@@ -1766,13 +1818,13 @@ FindSaddlePoint_LevelSetT(std::vector<double>& allFieldVals,
 	  if( minFieldVals[treeIDtoReplace] < minFieldVals[treeIDs[J]] )
 	    minFieldVals[treeIDs[J]] = minFieldVals[treeIDtoReplace];
 
-	  for(int k=i; k >=0; k--) {
-	    K = ordering[k];
-	    if(treeIDs[K] == treeIDtoReplace) {
-	      treeIDs[K] = treeIDs[J];
-	      treeSizes[treeIDs[J]]++;
-	    }
+	  std::vector<int>& replaced = treeMembers[treeIDtoReplace];
+	  for(std::size_t k=0; k < replaced.size(); k++) {
+	    treeIDs[replaced[k]] = treeIDs[J];
+	    treeSizes[treeIDs[J]]++;
 	  }
+	  treeMembers[treeIDs[J]].insert(treeMembers[treeIDs[J]].end(), replaced.begin(), replaced.end());
+	  replaced.clear();
 	  treeSizes[treeIDtoReplace] = 0;
 	  nTrees -= 1;
 
@@ -1815,6 +1867,7 @@ FindSaddlePoint_LevelSetT(std::vector<double>& allFieldVals,
       treeIDs[I] = nextAvailableTreeID++;
       minFieldVals.push_back(allFieldVals[I]);
       treeSizes.push_back(1);
+      treeMembers.push_back(std::vector<int>(1, I));
 
       nTrees += 1;
       if(nTrees > nMaxTrees) nMaxTrees = nTrees;
@@ -2114,10 +2167,8 @@ getImagePointValues(const double current_time,
   imagePtGradComps.fill(0.0);
 
   if(bAggregateWorksets) {
-    //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    //Use cached field and coordinate values near each image point to perform fill
+    addCachedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2184,10 +2235,8 @@ getFinalImagePointValues(const double current_time,
   finalPtWeights.fill(0.0);
 
   if(bAggregateWorksets) {
-    //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addFinalImagePointData( vCoords[i].data, vFieldValues[i] );
-    } 
+    //Use cached field and coordinate values near each final point to perform fill
+    addCachedFinalImagePointData();
   }
   else {
     mode = "Collect final image point data";
@@ -2262,10 +2311,8 @@ getImagePointValuesT(const double current_time,
   imagePtGradComps.fill(0.0);
 
   if(bAggregateWorksets) {
-    //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    //Use cached field and coordinate values near each image point to perform fill
+    addCachedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2574,6 +2621,55 @@ addFinalImagePointData(const double* p, double value)
   return;
 }
 
+// Same as addImagePointData over all cached points, but visiting only
+//  the cached points within the kernel cutoff of each image point
+void QCAD::SaddleValueResponseFunction::
+addCachedImagePointData()
+{
+  double w, effDims = (bLockToPlane && numDims > 2) ? 2 : numDims;
+  for(std::size_t i=0; i<nImagePts; i++) {
+    vGrid.findInBox(imagePts[i].coords.data(), pointFnCutoff(imagePts[i].radius), nearPts);
+    for(std::size_t n=0; n<nearPts.size(); n++) {
+      const int j = nearPts[n];
+      w = pointFn(imagePts[i].coords.distanceTo(vCoords[j].data) , imagePts[i].radius );
+      if(w > 0) {
+	imagePtWeights[i] += w;
+	imagePtValues[i] += w*vFieldValues[j];
+	for(std::size_t k=0; k<effDims; k++)
+	  imagePtGradComps[k*nImagePts+i] += w*vGrads[j].data[k];
+      }
+    }
+  }
+  return;
+}
+
+void QCAD::SaddleValueResponseFunction::
+addCachedFinalImagePointData()
+{
+  double w;
+  for(std::size_t i=0; i< finalPts.size(); i++) {
+    vGrid.findInBox(finalPts[i].coords.data(), pointFnCutoff(finalPts[i].radius), nearPts);
+    for(std::size_t n=0; n<nearPts.size(); n++) {
+      const int j = nearPts[n];
+      w = pointFn(finalPts[i].coords.distanceTo(vCoords[j].data) , finalPts[i].radius );
+      if(w > 0) {
+	finalPtWeights[i] += w;
+	finalPtValues[i] += w*vFieldValues[j];
+      }
+    }
+  }
+  return;
+}
+
+void QCAD::SaddleValueResponseFunction::
+buildCachedPointGrid()
+{
+  std::vector<double> flatCoords(vCoords.size()*numDims);
+  for(std::size_t i=0; i<vCoords.size(); i++)
+    for(std::size_t k=0; k<numDims; k++) flatCoords[i*numDims+k] = vCoords[i].data[k];
+  vGrid.build(flatCoords, numDims, pointFnCutoff(imagePtSize));
+}
+
 void QCAD::SaddleValueResponseFunction::
 accumulatePointData(const double* p, double value, double* grad)
 {
@@ -2660,6 +2756,12 @@ pointFn(double d, double radius) const {
   return (val >= 1e-2) ? val : 0.0;
 }
 
+double QCAD::SaddleValueResponseFunction::
+pointFnCutoff(double radius) const {
+  // pointFn(d, radius) is zero for d beyond radius*sqrt(2 ln(100)); pad slightly
+  return 1.001 * radius * sqrt(2*log(100.0));
+}
+
 int QCAD::SaddleValueResponseFunction::
 getHighestPtIndex() const 
 {
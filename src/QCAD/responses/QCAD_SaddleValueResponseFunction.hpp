@@ -10,6 +10,7 @@
 #include "Albany_FieldManagerScalarResponseFunction.hpp"
 #include "QCAD_MaterialDatabase.hpp"
 #include "QCAD_MathVector.hpp"
+#include "QCAD_PointGrid.hpp"
 
 #define MAX_DIMENSIONS 3
 
@@ -118,6 +119,9 @@ namespace QCAD {
     //! Get the number of responses
     virtual unsigned int numResponses() const;
 
+    //! The saddle search runs its own passes over the worksets
+    virtual bool isFusable() const { return false; }
+
     virtual void 
     evaluateResponseT(const double current_time,
 		     const Tpetra_Vector* xdot,
@@ -285,6 +289,14 @@ namespace QCAD {
     //! function giving distribution of weights for "point"
     double pointFn(double d, double radius) const;
 
+    //! distance beyond which pointFn(d, radius) is zero
+    double pointFnCutoff(double radius) const;
+
+    //! aggregate-worksets versions of addImagePointData and addFinalImagePointData
+    void addCachedImagePointData();
+    void addCachedFinalImagePointData();
+    void buildCachedPointGrid();
+
     //! helper function to get the highest image point (the one with the largest value)
     int getHighestPtIndex() const;
 
@@ -308,6 +320,8 @@ namespace QCAD {
     std::vector<double> vFieldValues;
     std::vector<maxDimPt> vCoords;
     std::vector<maxDimPt> vGrads;
+    QCAD::PointGrid vGrid;    // bucket grid over vCoords
+    std::vector<int> nearPts; // scratch for vGrid queries
 
     //! data for level set method
     std::vector<double> vlsFieldValues;
@@ -314,13 +314,22 @@ void AAdapt::AdaptiveSolutionManagerT::resizeMeshDataArrays(
   overlapped_soln = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, num_time_deriv + 1, false));
 
   overlapped_fT = Teuchos::rcp(new Tpetra_Vector(overlapMapT));
-  overlapped_jacT = Teuchos::rcp(new Tpetra_CrsMatrix(overlapJacGraphT));
+  overlapped_jacT = Teuchos::null;
+  overlapped_jacGraphT = overlapJacGraphT;
 
   // This call allocates the non-overlapped MV
   current_soln = disc_->getSolutionMV();
 
 }
 
+Teuchos::RCP<Tpetra_CrsMatrix>
+AAdapt::AdaptiveSolutionManagerT::get_overlapped_jacT()
+{
+  if (Teuchos::is_null(overlapped_jacT))
+    overlapped_jacT = Teuchos::rcp(new Tpetra_CrsMatrix(overlapped_jacGraphT));
+  return overlapped_jacT;
+}
+
 Teuchos::RCP<Tpetra_Vector>
 AAdapt::AdaptiveSolutionManagerT::updateAndReturnOverlapSolutionT(
     const Tpetra_Vector& solutionT /* not overlapped */)
@@ -52,7 +52,8 @@ public:
    Teuchos::RCP<const Tpetra_MultiVector> updateAndReturnOverlapSolutionMV(const Tpetra_MultiVector& solutionT /*not overlapped*/);
 
    Teuchos::RCP<Tpetra_Vector> get_overlapped_fT() {return overlapped_fT;}
-   Teuchos::RCP<Tpetra_CrsMatrix> get_overlapped_jacT() {return overlapped_jacT;}
+   //! Allocated on first use, so a matrix-free Jacobian never stores it
+   Teuchos::RCP<Tpetra_CrsMatrix> get_overlapped_jacT();
 
    Teuchos::RCP<Tpetra_Import> get_importerT() {return importerT;}
    Teuchos::RCP<Tpetra_Export> get_exporterT() {return exporterT;}
@@ -74,6 +75,7 @@ private:
 
     Teuchos::RCP<Tpetra_Vector> overlapped_fT;
     Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT;
+    Teuchos::RCP<const Tpetra_CrsGraph> overlapped_jacGraphT;
 
     // The solution directly from the discretization class
     Teuchos::RCP<Tpetra_MultiVector> current_soln;
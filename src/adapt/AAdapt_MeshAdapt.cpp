@@ -34,7 +34,8 @@ MeshAdapt(const Teuchos::RCP<Teuchos::ParameterList>& params_,
           const Teuchos::RCP<AAdapt::rc::Manager>& refConfigMgr_,
           const Teuchos::RCP<const Teuchos_Comm>& commT_)
   : AbstractAdapterT(params_, paramLib_, StateMgr_, commT_),
-    remeshFileIndex(1), rc_mgr(refConfigMgr_)
+    remeshFileIndex(1), rebalance_only(false), fill_cost(NULL),
+    rc_mgr(refConfigMgr_)
 {
   disc = StateMgr_.getDiscretization();
 
@@ -112,6 +113,35 @@ void AAdapt::MeshAdapt::initRcMgr () {
 AAdapt::MeshAdapt::~MeshAdapt() {}
 
 bool AAdapt::MeshAdapt::queryAdaptationCriteria(int iteration)
+{
+  rebalance_only = false;
+  if (queryRemeshStrategy(iteration))
+    return true;
+
+  // Between remeshes, rebalance when the measured residual fill is too uneven
+  const double maxFillImb = adapt_params_->get<double>("Maximum Fill Imbalance", 0.0);
+  if (maxFillImb > 0.0) {
+    // Unit weights would rebuild the same partition and trigger again
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        adapt_params_->get<std::string>("Load Balancing Weights", "Default") != "Fill Cost",
+        std::logic_error,
+        "Maximum Fill Imbalance needs \"Load Balancing Weights\" = \"Fill Cost\"\n");
+    TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(rc_mgr), std::logic_error,
+        "Maximum Fill Imbalance is not supported with reference configuration updating\n");
+  }
+  if (maxFillImb > 0.0 && iteration > 1) {
+    const double fillImb = pumi_discretization->getFillImbalance();
+    if (fillImb > maxFillImb) {
+      *output_stream_ << "Fill imbalance " << fillImb << " exceeds "
+                      << maxFillImb << ": rebalancing the mesh" << std::endl;
+      rebalance_only = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool AAdapt::MeshAdapt::queryRemeshStrategy(int iteration)
 {
   adapt_params_->set<int>("LastIter", iteration);
   std::string strategy = adapt_params_->get<std::string>("Remesh Strategy", "Step Number");
@@ -181,7 +211,19 @@ void AAdapt::MeshAdapt::beforeAdapt()
   TEUCHOS_FUNC_TIME_MONITOR("AlbanyAdapt: Transfer to APF Mesh");
   if (should_transfer_ip_data)
     pumi_discretization->attachQPData();
-  szField->preProcessOriginalMesh();
+  const std::string weights =
+    adapt_params_->get<std::string>("Load Balancing Weights", "Default");
+  if (weights == "Fill Cost") {
+    fill_cost = pumi_discretization->attachFillCost();
+    if (fill_cost == NULL)
+      *output_stream_ << "No fill cost measured on this mesh (is Measure Fill Cost set?): "
+                      << "balancing with the default weights" << std::endl;
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION(weights != "Default", std::logic_error,
+        "Unknown \"Load Balancing Weights\" option " << weights << std::endl);
+  }
+  if (!rebalance_only)
+    szField->preProcessOriginalMesh();
 }
 
 void AAdapt::MeshAdapt::adaptInPartition()
@@ -202,11 +244,25 @@ namespace {
     m->end(it);
   }
 
-  void runParmaVtxElm(ma::Mesh* m, double maxImb)
+  void setFillCostWeights(ma::Mesh* m, ma::Tag* weights, apf::Field* cost)
+  {
+    ma::Entity* e;
+    apf::MeshIterator* it = m->begin(m->getDimension());
+    while ((e = m->iterate(it))) {
+      double w = apf::getScalar(cost,e,0);
+      m->setDoubleTag(e,weights,&w);
+    }
+    m->end(it);
+  }
+
+  void runParmaVtxElm(ma::Mesh* m, double maxImb, apf::Field* cost)
   {
     ma::Tag* weights = m->createDoubleTag("ma_weight",1);
     setUnitEntWeights(m,weights,0);
-    setUnitEntWeights(m,weights,m->getDimension());
+    if (cost)
+      setFillCostWeights(m,weights,cost);
+    else
+      setUnitEntWeights(m,weights,m->getDimension());
     apf::Balancer* b = Parma_MakeVtxElmBalancer(m);
     b->balance(weights,maxImb);
     delete b;
@@ -215,9 +271,14 @@ namespace {
     m->destroyTag(weights);
   }
 
-  void runZoltanBal(ma::Mesh* m, double maxImb)
+  void runZoltanBal(ma::Mesh* m, double maxImb, apf::Field* cost)
   {
-    ma::Tag* weights = Parma_WeighByMemory(m);
+    ma::Tag* weights;
+    if (cost) {
+      weights = m->createDoubleTag("ma_weight",1);
+      setFillCostWeights(m,weights,cost);
+    } else
+      weights = Parma_WeighByMemory(m);
     apf::Balancer* b = makeZoltanBalancer(m, apf::GRAPH, apf::REPARTITION);
     b->balance(weights,maxImb);
     delete b;
@@ -225,11 +286,13 @@ namespace {
     m->destroyTag(weights);
   }
 
-  void postBalance(ma::Mesh* m, std::string const& method, double maxImb) {
+  // cost: measured fill cost of the elements, or null for the default weights
+  void postBalance(ma::Mesh* m, std::string const& method, double maxImb,
+                   apf::Field* cost) {
     if (method == "zoltan") {
-      runZoltanBal(m, maxImb);
+      runZoltanBal(m, maxImb, cost);
     } else if (method == "parma") {
-      runParmaVtxElm(m, maxImb);
+      runParmaVtxElm(m, maxImb, cost);
     } else if (method == "none") {
     } else {
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
@@ -248,9 +311,15 @@ void AAdapt::MeshAdapt::afterAdapt()
     adapt_params_->get<Teuchos::Array<std::string> >(
         "Load Balancing", defaultStArgs);
   double maxImb = adapt_params_->get<double>("Maximum LB Imbalance", 1.30);
-  postBalance(mesh, loadBalancing[2], maxImb);
+  postBalance(mesh, loadBalancing[2], maxImb, fill_cost);
 
-  szField->postProcessFinalMesh();
+  if (fill_cost) {
+    pumi_discretization->detachFillCost();
+    fill_cost = NULL;
+  }
+
+  if (!rebalance_only)
+    szField->postProcessFinalMesh();
 
   mesh->verify();
 
@@ -337,7 +406,12 @@ bool AAdapt::MeshAdapt::adaptMesh()
   initAdapt();
 
   bool success;
-  if (rc_mgr.is_null()) {
+  if (rebalance_only) {
+    // The partition changes, the elements do not
+    beforeAdapt();
+    afterAdapt();
+    success = true;
+  } else if (rc_mgr.is_null()) {
     // Old method. No reference configuration updating.
     if ( ! al::correctnessTestSkip()) {
       beforeAdapt();
@@ -510,6 +584,8 @@ AAdapt::MeshAdapt::getValidAdapterParameters() const
   validPL->set<std::string>("State Variable", "", "SPR operates on this variable");
   validPL->set<Teuchos::Array<std::string> >("Load Balancing", defaultStArgs, "Turn on predictive load balancing");
   validPL->set<double>("Maximum LB Imbalance", 1.3, "Set maximum imbalance tolerance for predictive laod balancing");
+  validPL->set<std::string>("Load Balancing Weights", "Default", "Element weights of the post-adapt balancing: Default or Fill Cost (needs Measure Fill Cost)");
+  validPL->set<double>("Maximum Fill Imbalance", 0.0, "Rebalance between remeshes when the measured fill imbalance exceeds this (0 = never); needs Load Balancing Weights = Fill Cost");
   validPL->set<std::string>("Adaptation Displacement Vector", "", "Name of APF displacement field");
   validPL->set<bool>("Transfer IP Data", false, "Turn on solution transfer of integration point data");
   validPL->set<double>("Minimum Part Density", 1000, "Minimum elements per part: triggers partition shrinking");
@@ -69,9 +69,18 @@ private:
 
   bool should_transfer_ip_data;
 
+  //! Set by queryAdaptationCriteria when the measured fill imbalance, not
+  //! the remesh strategy, asked for this step: rebalance without adapting
+  bool rebalance_only;
+
+  //! Measured fill cost carried through the adaptation, when "Load
+  //! Balancing Weights" is "Fill Cost"
+  apf::Field* fill_cost;
+
   Teuchos::RCP<rc::Manager> rc_mgr;
 
   void initRcMgr();
+  bool queryRemeshStrategy(int iteration);
   void checkValidStateVariable(
     const Albany::StateManager& state_mgr,
     const std::string name);
@@ -26,11 +26,14 @@
 #include "Albany_StateInfoStruct.hpp"
 #include "Albany_NodalDOFManager.hpp"
 #include "Albany_AbstractMeshStruct.hpp"
+#include "Albany_LayeredColumns.hpp"
 
 namespace AAdapt { namespace rc { class Manager; } }
 
 namespace Albany {
 
+class JacobianAssemblyPlan;
+
 typedef std::map<std::string, std::vector<std::vector<int> > > NodeSetList;
 typedef std::map<std::string, std::vector<GO> > NodeSetGIDsList;
 typedef std::map<std::string, std::vector<double*> > NodeSetCoordList;
@@ -65,13 +68,16 @@ struct WorksetArray {
    typedef Teuchos::ArrayRCP<T> type;
 };
 
+//! Flat (El, Local Node, Eq) -> unkLID connectivity of one workset
+typedef Kokkos::View<LO***, PHX::Device> WsElNodeEqIDView;
+
 class AbstractDiscretization {
   public:
 
     typedef std::map<std::string,Teuchos::RCP<Albany::AbstractDiscretization> > SideSetDiscretizationsType;
 
     //! Constructor
-    AbstractDiscretization() {};
+    AbstractDiscretization() : meshGeneration(0) {};
 
     //! Destructor
     virtual ~AbstractDiscretization() {};
@@ -121,6 +127,17 @@ class AbstractDiscretization {
     virtual Teuchos::RCP<const Tpetra_CrsGraph> getImplicitOverlapJacobianGraphT() const = 0;
 #endif
 
+    //! Get node-to-node Tpetra Jacobian graph (for Block CRS Jacobian storage)
+    /*! Returns null unless the discretization was asked for Block CRS storage. */
+    virtual Teuchos::RCP<const Tpetra_CrsGraph> getNodeJacobianGraphT() const { return Teuchos::null; }
+
+    //! Get node-to-node Tpetra overlap Jacobian graph (for Block CRS Jacobian storage)
+    virtual Teuchos::RCP<const Tpetra_CrsGraph> getOverlapNodeJacobianGraphT() const { return Teuchos::null; }
+
+    //! Get the cached positions of the element Jacobian entries in the overlap
+    //! Jacobian values, or null if the discretization does not provide them
+    virtual Teuchos::RCP<const JacobianAssemblyPlan> getJacobianAssemblyPlan() const { return Teuchos::null; }
+
 #if defined(ALBANY_EPETRA)
     //! Get Epetra Node map
     virtual Teuchos::RCP<const Epetra_Map> getNodeMap() const = 0;
@@ -162,6 +179,14 @@ class AbstractDiscretization {
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type&
       getWsElNodeEqID() const = 0;
 
+    //! Get contiguous (El, Local Node, Eq) -> unkLID views, one per workset;
+    //! empty if the discretization does not build them
+    virtual const WorksetArray<WsElNodeEqIDView>::type&
+      getWsElNodeEqIDView() const {
+      static const WorksetArray<WsElNodeEqIDView>::type empty;
+      return empty;
+    }
+
     //! Get map from (Ws, El, Local Node) -> unkGID
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
       getWsElNodeID() const = 0;
@@ -178,6 +203,13 @@ class AbstractDiscretization {
     //! Retrieve coodinate ptr_field (ws, el, node)
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type& getCoords() const = 0;
 
+    //! Basal columns of the cells of each workset of a layered mesh; empty if
+    //! the mesh is not layered or the discretization does not build them
+    virtual const WorksetArray<LayeredColumns>::type& getWsLayeredColumns() const {
+      static const WorksetArray<LayeredColumns>::type empty;
+      return empty;
+    }
+
     //! Get coordinates (overlap map).
     virtual const Teuchos::ArrayRCP<double>& getCoordinates() const = 0;
     //! Set coordinates (overlap map) for mesh adaptation.
@@ -219,6 +251,11 @@ class AbstractDiscretization {
     //! Retrieve Vector (length num worksets) of Physics Index
     virtual const WorksetArray<int>::type& getWsPhysIndex() const = 0;
 
+    //! Fill Cost: record the wall time, in seconds, of one residual fill of
+    //! each workset. Discretizations that rebalance accumulate it to weigh
+    //! their elements; the others ignore it.
+    virtual void addWorksetFillTime(const Teuchos::ArrayView<const double>& seconds) {}
+
     //! Retrieve connectivity map from elementGID to workset
     virtual WsLIDList&  getElemGIDws() = 0;
     virtual const WsLIDList&  getElemGIDws() const = 0;
@@ -283,13 +320,25 @@ class AbstractDiscretization {
     virtual void writeSolutionToFileT(const Tpetra_Vector &solutionT, const double time, const bool overlapped = false) = 0;
     virtual void writeSolutionMVToFile(const Tpetra_MultiVector &solutionT, const double time, const bool overlapped = false) = 0;
 
+    //! Block until every output step queued so far is written, and throw if
+    //! one failed. Discretizations that write synchronously do nothing.
+    virtual void flushOutput() {}
+
     //! update the mesh
     virtual void updateMesh(bool shouldTransferIPData = false) = 0;
 
+    //! Number of mesh updates; changes whenever the maps, graphs and worksets are rebuilt
+    int getMeshGeneration() const { return meshGeneration; }
+
     //! Get Numbering for layered mesh (mesh structred in one direction)
     virtual Teuchos::RCP<LayeredMeshNumbering<LO> > getLayeredMeshNumbering() = 0;
 
 
+  protected:
+
+    //! Incremented by updateMesh
+    int meshGeneration;
+
   private:
 
     //! Private to prohibit copying
@@ -56,7 +56,8 @@ Albany::DiscretizationFactory::DiscretizationFactory(
   const Teuchos::RCP<const Teuchos_Comm>& commT_,
   const bool explicit_scheme_) :
   commT(commT_),
-  explicit_scheme(explicit_scheme_) {
+  explicit_scheme(explicit_scheme_),
+  central_difference(false) {
 
   discParams = Teuchos::sublist(topLevelParams, "Discretization", true);
 
@@ -68,6 +69,8 @@ Albany::DiscretizationFactory::DiscretizationFactory(
 
     Teuchos::RCP<Teuchos::ParameterList> problemParams = Teuchos::sublist(topLevelParams, "Problem", true);
 
+    central_difference = problemParams->get("Second Order", "No") == "Central Difference";
+
     if(problemParams->isSublist("Adaptation"))
 
       adaptParams = Teuchos::sublist(problemParams, "Adaptation", true);
@@ -524,7 +527,7 @@ Albany::DiscretizationFactory::createDiscretizationFromInternalMeshStruct(
           disc = Teuchos::rcp(new Albany::STKDiscretizationStokesH(ms, commT, rigidBodyModes));
         else
 #endif
-          disc = Teuchos::rcp(new Albany::STKDiscretization(ms, commT, rigidBodyModes, sideSetEquations));
+          disc = Teuchos::rcp(new Albany::STKDiscretization(ms, commT, rigidBodyModes, sideSetEquations, central_difference));
         disc->updateMesh();
         return disc;
       }
@@ -141,6 +141,9 @@ class DiscretizationFactory {
     //Flag for explicit time-integration scheme, used in Aeras
     bool explicit_scheme;
 
+    //! Central difference never forms a Jacobian, so STK skips the graphs
+    bool central_difference;
+
 #ifdef ALBANY_CUTR
     Teuchos::RCP<CUTR::CubitMeshMover> meshMover;
 #endif
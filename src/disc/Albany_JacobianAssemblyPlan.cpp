@@ -0,0 +1,73 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_JacobianAssemblyPlan.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+Albany::JacobianAssemblyPlan::
+JacobianAssemblyPlan(
+  const Tpetra_CrsGraph& overlapGraphT,
+  const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type& wsElNodeEqID)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany: Jacobian Assembly Plan");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(!overlapGraphT.isFillComplete() || !overlapGraphT.isStorageOptimized(),
+    std::logic_error, "JacobianAssemblyPlan: the overlap graph must be fill complete "
+    "with optimized storage." << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    overlapGraphT.getNodeNumEntries() > static_cast<size_t>(std::numeric_limits<LO>::max()),
+    std::logic_error, "JacobianAssemblyPlan: too many local entries for LO offsets." << std::endl);
+
+  // With optimized storage the values of row r start at the sum of the
+  // lengths of rows 0..r-1, and the column indices of each row are sorted.
+  const LO numRows = overlapGraphT.getNodeNumRows();
+  std::vector<LO> rowStart(numRows + 1, 0);
+  for (LO r = 0; r < numRows; ++r)
+    rowStart[r+1] = rowStart[r] + overlapGraphT.getNumEntriesInLocalRow(r);
+
+  const int numWorksets = wsElNodeEqID.size();
+  offsets.resize(numWorksets);
+
+  Teuchos::ArrayView<const LO> rowInds;
+  for (int ws = 0; ws < numWorksets; ++ws) {
+    const int numCells = wsElNodeEqID[ws].size();
+    if (numCells == 0) continue;
+    const int numNodes = wsElNodeEqID[ws][0].size();
+    const int neq = wsElNodeEqID[ws][0][0].size();
+    const int nunk = numNodes*neq;
+
+    Teuchos::ArrayRCP<LO>& wsOffsets = offsets[ws];
+    wsOffsets.resize(numCells*nunk*nunk);
+    for (int cell = 0; cell < numCells; ++cell) {
+      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> >& nodeID = wsElNodeEqID[ws][cell];
+      for (int node = 0; node < numNodes; ++node) {
+        for (int eq = 0; eq < neq; ++eq) {
+          const LO row = nodeID[node][eq];
+          overlapGraphT.getLocalRowView(row, rowInds);
+          LO* rowOffsets = &wsOffsets[((cell*numNodes + node)*neq + eq)*nunk];
+          for (int node_col = 0; node_col < numNodes; ++node_col) {
+            for (int eq_col = 0; eq_col < neq; ++eq_col) {
+              const LO col = nodeID[node_col][eq_col];
+              const LO* first = rowInds.getRawPtr();
+              const LO* last = first + rowInds.size();
+              const LO* pos = std::lower_bound(first, last, col);
+              TEUCHOS_TEST_FOR_EXCEPTION(pos == last || *pos != col, std::logic_error,
+                "JacobianAssemblyPlan: entry (" << row << ", " << col
+                << ") is not in the overlap graph." << std::endl);
+              rowOffsets[neq*node_col + eq_col] = rowStart[row] + (pos - first);
+            }
+          }
+        }
+      }
+    }
+  }
+}
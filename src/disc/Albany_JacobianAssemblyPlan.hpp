@@ -0,0 +1,43 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_JACOBIANASSEMBLYPLAN_HPP
+#define ALBANY_JACOBIANASSEMBLYPLAN_HPP
+
+#include "Teuchos_ArrayRCP.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractDiscretization.hpp"
+
+namespace Albany {
+
+  //! Precomputed positions of the element Jacobian entries in the values
+  //! array of the overlapped CRS Jacobian
+  /*!
+   * For every (workset, cell, node, eq) row and every element unknown lunk,
+   * the plan stores the offset of the (row, col) entry in the local values
+   * array of a matrix built on the overlap graph. ScatterResidual<Jacobian>
+   * then adds into the values directly instead of searching each row for
+   * its column indices on every fill. The plan is only valid for the graph
+   * and worksets it was built from, so discretizations drop it on remesh.
+   */
+  class JacobianAssemblyPlan {
+  public:
+
+    JacobianAssemblyPlan(
+      const Tpetra_CrsGraph& overlapGraphT,
+      const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type& wsElNodeEqID);
+
+    //! Offsets of workset ws, indexed by ((cell*numNodes + node)*neq + eq)*nunk + lunk
+    const Teuchos::ArrayRCP<LO>& getOffsets(const int ws) const { return offsets[ws]; }
+
+  private:
+
+    WorksetArray<Teuchos::ArrayRCP<LO> >::type offsets;
+  };
+
+}
+
+#endif // ALBANY_JACOBIANASSEMBLYPLAN_HPP
@@ -0,0 +1,73 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_LayeredColumns.hpp"
+
+#include <algorithm>
+
+#include "Teuchos_TestForException.hpp"
+#include "Albany_AbstractDiscretization.hpp"
+
+Albany::LayeredColumns::
+LayeredColumns(const LayeredMeshNumbering<LO>& numbering,
+               const Tpetra_Map& overlapNodeMap,
+               const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& elNodeID)
+  : numNodes(0)
+{
+  const int numCells = elNodeID.size();
+  if (numCells == 0) return;
+  numNodes = elNodeID[0].size();
+
+  std::vector<LO> nodeBase(numCells*numNodes);
+  nodeLevel.resize(numCells*numNodes);
+  for (int cell = 0; cell < numCells; ++cell)
+    for (int node = 0; node < numNodes; ++node) {
+      const LO lnodeId = overlapNodeMap.getLocalElement(elNodeID[cell][node]);
+      TEUCHOS_TEST_FOR_EXCEPTION(lnodeId < 0, std::logic_error,
+        "LayeredColumns: node " << elNodeID[cell][node]
+        << " is not in the overlap node map." << std::endl);
+      LO baseId, ilevel;
+      numbering.getIndices(lnodeId, baseId, ilevel);
+      nodeBase[cell*numNodes + node] = baseId;
+      nodeLevel[cell*numNodes + node] = ilevel;
+    }
+
+  columns = nodeBase;
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+  nodeColumn.resize(numCells*numNodes);
+  for (std::size_t i = 0; i < nodeBase.size(); ++i)
+    nodeColumn[i] = std::lower_bound(columns.begin(), columns.end(), nodeBase[i]) - columns.begin();
+}
+
+const Albany::LayeredColumns&
+Albany::LayeredColumns::
+get(AbstractDiscretization& disc, const int ws, LayeredColumns& scratch)
+{
+  const WorksetArray<LayeredColumns>::type& wsColumns = disc.getWsLayeredColumns();
+  if (ws < wsColumns.size())
+    return wsColumns[ws];
+
+  const Teuchos::RCP<LayeredMeshNumbering<LO> > numbering = disc.getLayeredMeshNumbering();
+  TEUCHOS_TEST_FOR_EXCEPTION(numbering.is_null(), std::logic_error,
+    "LayeredColumns: the mesh is not layered." << std::endl);
+  scratch = LayeredColumns(*numbering, *disc.getOverlapNodeMapT(), disc.getWsElNodeID()[ws]);
+  return scratch;
+}
+
+void
+Albany::LayeredColumns::
+trapezoidWeights(const Teuchos::ArrayRCP<double>& layers_ratio,
+                 std::vector<double>& weights)
+{
+  const int numLayers = layers_ratio.size();
+  weights.assign(numLayers+1, 0.0);
+  for (int il = 0; il < numLayers; ++il) {
+    weights[il] += 0.5*layers_ratio[il];
+    weights[il+1] += 0.5*layers_ratio[il];
+  }
+}
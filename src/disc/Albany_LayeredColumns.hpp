@@ -0,0 +1,90 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_LAYEREDCOLUMNS_HPP
+#define ALBANY_LAYEREDCOLUMNS_HPP
+
+#include <vector>
+
+#include "Teuchos_ArrayRCP.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractMeshStruct.hpp"
+
+namespace Albany {
+
+  class AbstractDiscretization;
+
+  //! Basal columns of the cells of one workset of an extruded mesh
+  /*!
+   * Every node of a layered mesh sits at a level of the column above a basal
+   * node, and the overlap LIDs of the column stack are given arithmetically
+   * by LayeredMeshNumbering::getId. This class maps each (cell, node) of the
+   * workset to its column and level once, so that vertical operators can
+   * stream each column a single time (O(numColumns*numLevels)) and then
+   * look the result up per node, instead of walking the whole column again
+   * for every (cell, node) that touches it.
+   */
+  class LayeredColumns {
+  public:
+
+    LayeredColumns() : numNodes(0) {}
+
+    //! elNodeID(cell, node) holds the overlap node GIDs of the workset
+    LayeredColumns(const LayeredMeshNumbering<LO>& numbering,
+                   const Tpetra_Map& overlapNodeMap,
+                   const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& elNodeID);
+
+    //! Columns of workset ws, from the discretization when it caches them,
+    //! otherwise built into scratch
+    static const LayeredColumns& get(AbstractDiscretization& disc, const int ws,
+                                     LayeredColumns& scratch);
+
+    int getNumColumns() const { return columns.size(); }
+
+    //! Basal id of column c, to be passed to LayeredMeshNumbering::getId
+    LO getColumnId(const int c) const { return columns[c]; }
+
+    //! Index in [0, getNumColumns()) of the column of (cell, node)
+    int getColumn(const int cell, const int node) const { return nodeColumn[cell*numNodes + node]; }
+
+    //! Level of (cell, node) in its column
+    int getLevel(const int cell, const int node) const { return nodeLevel[cell*numNodes + node]; }
+
+    //! Trapezoidal weights of the levels for the integral over the whole column
+    static void trapezoidWeights(const Teuchos::ArrayRCP<double>& layers_ratio,
+                                 std::vector<double>& weights);
+
+    //! integral[c*numLevels + l] = trapezoidal integral of f from level 0 to
+    //! level l of column c, where f(inode) is the value at the node of LID inode.
+    //! One pass per column.
+    template<typename NodalFn>
+    void integrateUp(const LayeredMeshNumbering<LO>& numbering, const NodalFn& f,
+                     std::vector<double>& integral) const {
+      const int numLevels = numbering.numLevels;
+      integral.resize(columns.size()*numLevels);
+      for (std::size_t c = 0; c < columns.size(); ++c) {
+        double* colIntegral = &integral[c*numLevels];
+        double below = f(numbering.getId(columns[c], 0));
+        colIntegral[0] = 0;
+        for (int il = 1; il < numLevels; ++il) {
+          const double above = f(numbering.getId(columns[c], il));
+          colIntegral[il] = colIntegral[il-1] + 0.5*(below + above)*numbering.layers_ratio[il-1];
+          below = above;
+        }
+      }
+    }
+
+  private:
+
+    int numNodes;
+
+    std::vector<LO> columns;
+    std::vector<int> nodeColumn, nodeLevel;
+  };
+
+}
+
+#endif // ALBANY_LAYEREDCOLUMNS_HPP
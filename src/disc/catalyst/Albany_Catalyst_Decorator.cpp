@@ -85,6 +85,12 @@ Decorator::getWsElNodeEqID() const
   return discretization->getWsElNodeEqID();
 }
 
+const WorksetArray<WsElNodeEqIDView>::type &
+Decorator::getWsElNodeEqIDView() const
+{
+  return discretization->getWsElNodeEqIDView();
+}
+
 Teuchos::ArrayRCP<double> &Decorator::getCoordinates() const
 {
   return discretization->getCoordinates();
@@ -95,6 +101,11 @@ const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type &Decor
   return discretization->getCoords();
 }
 
+const WorksetArray<LayeredColumns>::type &Decorator::getWsLayeredColumns() const
+{
+  return discretization->getWsLayeredColumns();
+}
+
 
 void Decorator::printCoords() const
 {
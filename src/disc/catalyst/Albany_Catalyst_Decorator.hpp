@@ -46,10 +46,12 @@ public:
 
   //! Get map from (Ws, El, Local Node) -> NodeLID
   const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> > > >::type& getWsElNodeEqID() const;
+  const WorksetArray<WsElNodeEqIDView>::type& getWsElNodeEqIDView() const;
 
   //! Retrieve coodinate vector (num_used_nodes * 3)
   Teuchos::ArrayRCP<double>& getCoordinates() const;
   const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type& getCoords() const;
+  const WorksetArray<LayeredColumns>::type& getWsLayeredColumns() const;
 
   //! Print the coordinates for debugging
   void printCoords() const;
@@ -10,6 +10,7 @@
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Export.h"
 #endif
+#include "Teuchos_CommHelpers.hpp"
 
 #include "Albany_Utils.hpp"
 #ifdef ALBANY_EPETRA
@@ -63,6 +64,7 @@ Albany::APFDiscretization::APFDiscretization(Teuchos::RCP<Albany::APFMeshStruct>
   neq(meshStruct_->neq),
   meshStruct(meshStruct_),
   interleavedOrdering(meshStruct_->interleavedOrdering),
+  numFillTimes(0),
   outputInterval(0),
   continuationStep(0)
 {
@@ -1508,6 +1510,68 @@ void Albany::APFDiscretization::removeNodalDataFromAPF () {
   }
 }
 
+void
+Albany::APFDiscretization::addWorksetFillTime(const Teuchos::ArrayView<const double>& seconds)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(static_cast<std::size_t>(seconds.size()) != buckets.size(), std::logic_error,
+      "Error! Fill times given for " << seconds.size() << " worksets, but the "
+      "discretization has " << buckets.size() << std::endl);
+  for (std::size_t b=0; b < buckets.size(); ++b)
+    bucketFillTime[b] += seconds[b];
+  ++numFillTimes;
+}
+
+namespace {
+const char* const fill_cost_name = "fill_cost";
+}
+
+apf::Field*
+Albany::APFDiscretization::attachFillCost()
+{
+  if (numFillTimes == 0) return NULL;
+
+  // the global mean fill time of one element
+  double local[2] = {0.0, 0.0}, global[2];
+  for (std::size_t b=0; b < buckets.size(); ++b) {
+    local[0] += bucketFillTime[b];
+    local[1] += buckets[b].size();
+  }
+  Teuchos::reduceAll(*commT, Teuchos::REDUCE_SUM, 2, local, global);
+  if (global[0] <= 0.0) return NULL;
+  const double meanTime = global[0] / global[1];
+
+  apf::Mesh2* m = meshStruct->getMesh();
+  apf::Field* f = apf::createField(m, fill_cost_name, apf::SCALAR,
+                                   apf::getVoronoiShape(m->getDimension(), 1));
+  for (std::size_t b=0; b < buckets.size(); ++b) {
+    const double w = bucketFillTime[b] / buckets[b].size() / meanTime;
+    for (std::size_t e=0; e < buckets[b].size(); ++e)
+      apf::setScalar(f, buckets[b][e], 0, w);
+  }
+  return f;
+}
+
+void
+Albany::APFDiscretization::detachFillCost()
+{
+  apf::Field* f = meshStruct->getMesh()->findField(fill_cost_name);
+  if (f) apf::destroyField(f);
+}
+
+double
+Albany::APFDiscretization::getFillImbalance() const
+{
+  if (numFillTimes == 0) return 1.0;
+
+  double localTime = 0.0, maxTime, sumTime;
+  for (std::size_t b=0; b < buckets.size(); ++b)
+    localTime += bucketFillTime[b];
+  Teuchos::reduceAll(*commT, Teuchos::REDUCE_MAX, localTime, Teuchos::ptrFromRef(maxTime));
+  Teuchos::reduceAll(*commT, Teuchos::REDUCE_SUM, localTime, Teuchos::ptrFromRef(sumTime));
+  if (sumTime <= 0.0) return 1.0;
+  return maxTime * commT->getSize() / sumTime;
+}
+
 void
 Albany::APFDiscretization::updateMesh(bool shouldTransferIPData)
 {
@@ -1521,6 +1585,7 @@ Albany::APFDiscretization::updateMeshBase(bool shouldTransferIPData)
   // and then each time the mesh is adapted (called from AAdapt_MeshAdapt_Def.hpp - afterAdapt())
 
   TEUCHOS_FUNC_TIME_MONITOR("AlbanyAdapt: Transfer to Albany");
+  ++meshGeneration;
   computeOwnedNodesAndUnknowns();
   computeOverlapNodesAndUnknowns();
   setupMLCoords();
@@ -1530,6 +1595,10 @@ Albany::APFDiscretization::updateMeshBase(bool shouldTransferIPData)
   computeNodeSets();
   computeSideSets();
 
+  // measured fill costs belong to the old worksets
+  bucketFillTime.assign(buckets.size(), 0.0);
+  numFillTimes = 0;
+
   // transfer of internal variables
   if (shouldTransferIPData)
     copyQPStatesFromAPF();
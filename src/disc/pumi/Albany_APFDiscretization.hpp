@@ -180,6 +180,21 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     //! PUMI does not support MOR
     virtual bool supportsMOR() const { return false; }
 
+    //! Fill Cost: accumulate the measured residual fill time of each workset
+    virtual void addWorksetFillTime(const Teuchos::ArrayView<const double>& seconds);
+
+    //! Fill Cost: store each element's mean measured fill time, relative to
+    //! the global mean, in a one-point element field that mesh adaptation
+    //! carries to the new elements. Null if nothing was measured on this mesh.
+    apf::Field* attachFillCost();
+
+    //! Fill Cost: destroy the field made by attachFillCost, if any
+    void detachFillCost();
+
+    //! Fill Cost: max over mean of the ranks' mean measured fill times
+    //! (1 if nothing was measured on this mesh)
+    double getFillImbalance() const;
+
     apf::GlobalNumbering* getAPFGlobalNumbering() {return elementNumbering;}
 
     // Before mesh modification, qp data may be needed for solution transfer
@@ -554,6 +569,11 @@ class APFDiscretization : public Albany::AbstractDiscretization {
 
     std::vector< std::vector<apf::MeshEntity*> > buckets; // bucket of elements
 
+    //! Fill Cost: summed residual fill time of each bucket, and number of
+    //! fills measured since the mesh last changed
+    std::vector<double> bucketFillTime;
+    int numFillTimes;
+
     // storage to save the node coordinates of the nodesets visible to this PE
     std::map<std::string, std::vector<double> > nodeset_node_coords;
 
@@ -246,6 +246,10 @@ Albany::APFMeshStruct::setFieldAndBulkData(
   // Set the number of equation present per node. Needed by Albany_APFDiscretization.
   neq = neq_;
 
+  // The workset size of the mesh specs, possibly reduced by Auto Workset Size
+  // after they were built; APFDiscretization fills its buckets up to it.
+  worksetSize = worksetSize_;
+
   this->nodal_data_base = sis->getNodalDataBase();
 
   Teuchos::Array<std::string> defaultLayout; // empty
@@ -487,6 +491,8 @@ Albany::APFMeshStruct::getValidDiscretizationParameters() const
     "The discretization method, parsed in the Discretization Factory");
   validPL->set<int>("Cubature Degree", 3, "Integration order sent to Intrepid2");
   validPL->set<int>("Workset Size", 10000, "Upper bound on workset (bucket) size");
+  validPL->set<bool>("Auto Workset Size", false, "Shrink the workset size so that the field data of a workset fits in the cache");
+  validPL->set<int>("Workset Cache Size", 0, "Cache size in bytes for Auto Workset Size; 0 uses the L2 cache size");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
                      "Flag for different evaluation trees for each Element Block");
@@ -3652,6 +3652,7 @@ void Aeras::SpectralDiscretization::reNameExodusOutput(std::string& filename)
 void
 Aeras::SpectralDiscretization::updateMesh(bool /*shouldTransferIPData*/)
 {
+  ++meshGeneration;
 #ifdef OUTPUT_TO_SCREEN
   *out << "DEBUG: " << __PRETTY_FUNCTION__ << std::endl;
 #endif
@@ -59,6 +59,11 @@ namespace Albany {
     bool exoOutput;
     std::string exoOutFile;
     int exoOutputInterval;
+    //! Write the Exodus steps from a background thread
+    bool asyncExoOutput;
+    //! (output field, staging copy) pairs used by the asynchronous Exodus
+    //! output; the staging copies are declared before the meta data commit
+    std::vector<std::pair<stk::mesh::FieldBase*, stk::mesh::FieldBase*> > asyncOutputFields;
     std::string cdfOutFile;
     bool cdfOutput;
     unsigned nLat;
@@ -67,6 +72,18 @@ namespace Albany {
 
     bool transferSolutionToCoords;
 
+    //! How the overlap Jacobian graph is built: "Row-wise", "Entry-wise" or
+    //! "Compare" (build both and report the timings)
+    std::string jacobianGraphConstruction;
+
+    //! Storage of the Jacobian: "Point CRS" or "Block CRS" (one neq x neq
+    //! block per node pair, requires interleaved ordering)
+    std::string jacobianStorage;
+
+    //! Cache the positions of the element Jacobian entries in the overlap
+    //! Jacobian values and scatter through them
+    bool useJacobianAssemblyPlan;
+
     int num_time_deriv;
 
     // Solution history
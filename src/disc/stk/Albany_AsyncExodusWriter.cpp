@@ -0,0 +1,123 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_AsyncExodusWriter.hpp"
+
+#ifdef ALBANY_SEACAS
+
+#include <iostream>
+
+#ifdef ALBANY_MPI
+#include <mpi.h>
+#endif
+
+Albany::AsyncExodusWriter::
+AsyncExodusWriter(const Teuchos::RCP<stk::io::StkMeshIoBroker>& mesh_data_,
+                  size_t outputFileIdx_)
+  : mesh_data(mesh_data_),
+    outputFileIdx(outputFileIdx_),
+    time_label(0.0),
+    pending(false),
+    stop(false)
+{
+  thread = std::thread(&AsyncExodusWriter::run, this);
+}
+
+Albany::AsyncExodusWriter::~AsyncExodusWriter()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    stop = true;
+  }
+  cv.notify_all();
+  thread.join();
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    }
+    catch (const std::exception& e) {
+      std::cerr << "Albany::AsyncExodusWriter: last Exodus step not written: "
+                << e.what() << std::endl;
+    }
+    catch (...) {
+      std::cerr << "Albany::AsyncExodusWriter: last Exodus step not written"
+                << std::endl;
+    }
+  }
+}
+
+void Albany::AsyncExodusWriter::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [this] { return !pending; });
+  if (error) {
+    std::exception_ptr e = error;
+    error = std::exception_ptr();
+    std::rethrow_exception(e);
+  }
+}
+
+void Albany::AsyncExodusWriter::
+write(double time_label_,
+      const AbstractSTKFieldContainer::MeshVectorState& vectorGlobals_,
+      const AbstractSTKFieldContainer::MeshScalarIntegerState& integerGlobals_)
+{
+  wait();
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    time_label = time_label_;
+    vectorGlobals = vectorGlobals_;
+    integerGlobals = integerGlobals_;
+    pending = true;
+  }
+  cv.notify_all();
+}
+
+bool Albany::AsyncExodusWriter::
+isSupported(const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  if (commT->getSize() == 1) return true;
+#ifdef ALBANY_MPI
+  // The thread writes while the solve communicates.
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
+void Albany::AsyncExodusWriter::run()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    cv.wait(lock, [this] { return pending || stop; });
+    if (!pending) return;
+
+    // The solve does not touch the staging fields or the queued globals
+    // while a step is pending, so write without the lock.
+    lock.unlock();
+    try {
+      mesh_data->begin_output_step(outputFileIdx, time_label);
+      mesh_data->write_defined_output_fields(outputFileIdx);
+      for (auto& it : vectorGlobals)
+        mesh_data->write_global(outputFileIdx, it.first, it.second);
+      for (auto& it : integerGlobals)
+        mesh_data->write_global(outputFileIdx, it.first, it.second);
+      mesh_data->end_output_step(outputFileIdx);
+    }
+    catch (...) {
+      lock.lock();
+      error = std::current_exception();
+      lock.unlock();
+    }
+    lock.lock();
+    pending = false;
+    cv.notify_all();
+  }
+}
+
+#endif // ALBANY_SEACAS
@@ -0,0 +1,88 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_ASYNCEXODUSWRITER_HPP
+#define ALBANY_ASYNCEXODUSWRITER_HPP
+
+#ifdef ALBANY_SEACAS
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "Teuchos_RCP.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractSTKFieldContainer.hpp"
+
+#include <stk_io/StkMeshIoBroker.hpp>
+
+namespace Albany {
+
+/*!
+ * \brief Writes Exodus output steps from a background thread.
+ *
+ * The caller copies the output fields into their staging fields and then
+ * queues the step; the thread writes the staging fields while the solve
+ * goes on. At most one step is in flight: wait() blocks until the staging
+ * fields may be overwritten. Errors raised by the thread are rethrown by
+ * the next wait(), so owners should wait() before destroying the writer.
+ *
+ * The thread calls stk_io, and so MPI, alongside the solve. It is only
+ * used on a single rank, or when the MPI library was initialized with
+ * MPI_THREAD_MULTIPLE, which Albany::MPISession requests when the input
+ * file asks for asynchronous output.
+ */
+class AsyncExodusWriter {
+public:
+
+  AsyncExodusWriter(const Teuchos::RCP<stk::io::StkMeshIoBroker>& mesh_data,
+                    size_t outputFileIdx);
+
+  //! Finishes the queued step and stops the thread. A failure of that step
+  //! is reported on std::cerr, since a destructor cannot throw; call wait()
+  //! first to have it thrown.
+  ~AsyncExodusWriter();
+
+  //! Blocks until the previously queued step has been written
+  void wait();
+
+  //! Queues a step; the staging fields must already hold its data
+  void write(double time_label,
+             const AbstractSTKFieldContainer::MeshVectorState& vectorGlobals,
+             const AbstractSTKFieldContainer::MeshScalarIntegerState& integerGlobals);
+
+  //! Whether the MPI library allows the thread to write alongside the solve
+  static bool isSupported(const Teuchos::RCP<const Teuchos_Comm>& commT);
+
+private:
+
+  AsyncExodusWriter(const AsyncExodusWriter&);
+  AsyncExodusWriter& operator=(const AsyncExodusWriter&);
+
+  void run();
+
+  Teuchos::RCP<stk::io::StkMeshIoBroker> mesh_data;
+  size_t outputFileIdx;
+
+  // The queued step. Globals are copied since the solve keeps updating them.
+  double time_label;
+  AbstractSTKFieldContainer::MeshVectorState vectorGlobals;
+  AbstractSTKFieldContainer::MeshScalarIntegerState integerGlobals;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool pending;
+  bool stop;
+  std::exception_ptr error;
+  std::thread thread;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_SEACAS
+
+#endif // ALBANY_ASYNCEXODUSWRITER_HPP
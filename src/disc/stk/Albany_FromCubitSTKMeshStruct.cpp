@@ -108,6 +108,7 @@ Albany::FromCubitSTKMeshStruct::FromCubitSTKMeshStruct(
   exoOutput = params->isType<string>("Exodus Output File Name");
   if (exoOutput)
     exoOutFile = params->get<string>("Exodus Output File Name");
+  asyncExoOutput = false;
   cdfOutput = params->isType<string>("NetCDF Output File Name");
   if (cdfOutput) 
     cdfOutFile = params->get<string>("NetCDF Output File Name");
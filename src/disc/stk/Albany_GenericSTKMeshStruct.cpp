@@ -17,6 +17,7 @@
 
 #ifdef ALBANY_SEACAS
 #include <stk_io/IossBridge.hpp>
+#include "Albany_AsyncExodusWriter.hpp"
 #endif
 
 #include "Albany_Utils.hpp"
@@ -195,6 +196,7 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
   if (exoOutput)
     exoOutFile = params->get<std::string>("Exodus Output File Name");
   exoOutputInterval = params->get<int>("Exodus Write Interval", 1);
+  asyncExoOutput = exoOutput && params->get<bool>("Asynchronous Exodus Output", false);
   cdfOutput = params->isType<std::string>("NetCDF Output File Name");
   if (cdfOutput)
     cdfOutFile = params->get<std::string>("NetCDF Output File Name");
@@ -219,6 +221,15 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
 
   transferSolutionToCoords = params->get<bool>("Transfer Solution to Coordinates", false);
 
+  jacobianGraphConstruction = params->get<std::string>("Jacobian Graph Construction", "Row-wise");
+
+  jacobianStorage = params->get<std::string>("Jacobian Storage", "Point CRS");
+
+  useJacobianAssemblyPlan = params->get<bool>("Jacobian Assembly Plan", false);
+
+  if (asyncExoOutput)
+    declareAsyncOutputFields(commT);
+
 #ifdef ALBANY_STK_PERCEPT
   // Build the eMesh if needed
   if(buildEMesh)
@@ -239,6 +250,86 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
 
 }
 
+namespace {
+#ifdef ALBANY_SEACAS
+// Declares a staging copy of f, with the same restrictions, if f is a
+// FieldType; returns NULL otherwise.
+template<class FieldType>
+stk::mesh::FieldBase*
+declareStagingField (stk::mesh::MetaData& meta, stk::mesh::FieldBase& f)
+{
+  if (dynamic_cast<FieldType*>(&f) == NULL) return NULL;
+  FieldType& staging =
+    meta.declare_field<FieldType>(f.entity_rank(), f.name() + "_async_output");
+  const stk::mesh::FieldRestrictionVector& restrictions = f.restrictions();
+  for (size_t i = 0; i < restrictions.size(); ++i)
+    meta.declare_field_restriction(staging, restrictions[i].selector(),
+                                   restrictions[i].num_scalars_per_entity(),
+                                   restrictions[i].dimension());
+  stk::io::set_field_role(staging, Ioss::Field::TRANSIENT);
+  return &staging;
+}
+#endif
+} // namespace
+
+void Albany::GenericSTKMeshStruct::
+declareAsyncOutputFields(const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+#ifdef ALBANY_SEACAS
+  typedef AbstractSTKFieldContainer FC;
+
+  // The writer thread calls MPI alongside the solve.
+  if (!AsyncExodusWriter::isSupported(commT)) {
+    if (commT->getRank() == 0)
+      *Teuchos::VerboseObjectBase::getDefaultOStream()
+        << "Warning: asynchronous Exodus output needs a single rank or"
+        << " MPI_THREAD_MULTIPLE; writing synchronously" << std::endl;
+    asyncExoOutput = false;
+    return;
+  }
+
+  // The writer thread reads the mesh, which adaptation modifies.
+  if (!adaptParams.is_null()) {
+    *Teuchos::VerboseObjectBase::getDefaultOStream()
+      << "Warning: asynchronous Exodus output is not available with mesh"
+      << " adaptation; writing synchronously" << std::endl;
+    asyncExoOutput = false;
+    return;
+  }
+
+  // Copy the list: declaring fields appends to the meta data field vector.
+  const stk::mesh::FieldVector fields = metaData->get_fields();
+  for (size_t i = 0; i < fields.size(); ++i) {
+    stk::mesh::FieldBase& f = *fields[i];
+    const Ioss::Field::RoleType* role = stk::io::get_field_role(f);
+    if (role == NULL || *role != Ioss::Field::TRANSIENT) continue;
+
+    stk::mesh::FieldBase* staging = declareStagingField<FC::ScalarFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::VectorFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::TensorFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::IntScalarFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::IntVectorFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::QPScalarFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::QPVectorFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::QPTensorFieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::QPTensor3FieldType>(*metaData, f);
+    if (!staging) staging = declareStagingField<FC::SphereVolumeFieldType>(*metaData, f);
+
+    if (!staging) {
+      *Teuchos::VerboseObjectBase::getDefaultOStream()
+        << "Warning: field " << f.name() << " has no staging type;"
+           << " falling back to synchronous Exodus output" << std::endl;
+      asyncExoOutput = false;
+      asyncOutputFields.clear();
+      return;
+    }
+    asyncOutputFields.push_back(std::make_pair(&f, staging));
+  }
+#else
+  asyncExoOutput = false;
+#endif
+}
+
 bool Albany::GenericSTKMeshStruct::buildPerceptEMesh(){
 
    // If there exists a nonempty "refine", "convert", or "enrich" string
@@ -1496,6 +1587,9 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
       "Name of solution_dotdot dtk written to Exodus file. Requires SEACAS build");
 #endif
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<bool>("Asynchronous Exodus Output", false,
+      "Write Exodus steps from a background thread while the solve continues."
+      " In parallel, needs an MPI library that provides MPI_THREAD_MULTIPLE");
   validPL->set<std::string>("NetCDF Output File Name", "",
       "Request NetCDF output to given file name. Requires SEACAS build");
   validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file");
@@ -1508,6 +1602,8 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<int>("Cubature Degree", 3, "Integration order sent to Intrepid2");
   validPL->set<std::string>("Cubature Rule", "", "Integration rule sent to Intrepid2: GAUSS, GAUSS_RADAU_LEFT, GAUSS_RADAU_RIGHT, GAUSS_LOBATTO");
   validPL->set<int>("Workset Size", 50, "Upper bound on workset (bucket) size");
+  validPL->set<bool>("Auto Workset Size", false, "Shrink the workset size so that the field data of a workset fits in the cache");
+  validPL->set<int>("Workset Cache Size", 0, "Cache size in bytes for Auto Workset Size; 0 uses the L2 cache size");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
@@ -1537,6 +1633,12 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
 
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Use Composite Tet 10", false, "Flag to use the composite tet 10 basis in Intrepid2");
+  validPL->set<std::string>("Jacobian Graph Construction", "Row-wise",
+      "Row-wise, Entry-wise, or Compare (builds the graph both ways and reports timings)");
+  validPL->set<std::string>("Jacobian Storage", "Point CRS",
+      "Point CRS, or Block CRS (assemble into a BlockCrsMatrix with block size neq)");
+  validPL->set<bool>("Jacobian Assembly Plan", false,
+      "Cache the Jacobian value offsets of every element entry and scatter through them");
 
   validPL->sublist("Required Fields Info", false, "Info for the creation of the required fields in the STK mesh");
 
@@ -72,6 +72,11 @@ namespace Albany {
                   const Teuchos::RCP<Albany::StateInfoStruct>& sis,
                   const int worksetSize_);
 
+    //! Declare the staging copies of the Exodus output fields used by the
+    //! asynchronous output, if it can run on commT; must run before the meta
+    //! data commit
+    void declareAsyncOutputFields(const Teuchos::RCP<const Teuchos_Comm>& commT);
+
     bool buildUniformRefiner();
 
     bool buildLocalRefiner();
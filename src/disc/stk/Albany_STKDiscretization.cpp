@@ -11,6 +11,10 @@
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_BucketArray.hpp"
+#include "Albany_JacobianAssemblyPlan.hpp"
+
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 #include <string>
 #include <iostream>
@@ -45,6 +49,9 @@ extern "C" {
 #endif
 
 #include <algorithm>
+#include <cstring>
+#include <set>
+#include "utility/ProfileGuard.hpp"
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Export.h"
 #include "EpetraExt_MultiVectorOut.h"
@@ -68,7 +75,8 @@ Albany::STKDiscretization::
 STKDiscretization(Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct_,
                   const Teuchos::RCP<const Teuchos_Comm>& commT_,
                   const Teuchos::RCP<Albany::RigidBodyModes>& rigidBodyModes_,
-                  const std::map<int,std::vector<std::string> >& sideSetEquations_) :
+                  const std::map<int,std::vector<std::string> >& sideSetEquations_,
+                  const bool explicit_scheme_) :
 
   out(Teuchos::VerboseObjectBase::getDefaultOStream()),
   previous_time_label(-1.0e32),
@@ -79,7 +87,8 @@ STKDiscretization(Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct_,
   neq(stkMeshStruct_->neq),
   stkMeshStruct(stkMeshStruct_),
   sideSetEquations(sideSetEquations_),
-  interleavedOrdering(stkMeshStruct_->interleavedOrdering)
+  interleavedOrdering(stkMeshStruct_->interleavedOrdering),
+  explicit_scheme(explicit_scheme_)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(commT_);
@@ -91,6 +100,10 @@ STKDiscretization(Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct_,
 Albany::STKDiscretization::~STKDiscretization()
 {
 #ifdef ALBANY_SEACAS
+  // Finish the queued exodus step before the mesh goes away. Owners that
+  // want a failure of that step thrown call flushOutput() first.
+  asyncWriter = Teuchos::null;
+
   if (stkMeshStruct->cdfOutput)
       if (netCDFp)
     if (const int ierr = nc_close (netCDFp))
@@ -250,6 +263,20 @@ Albany::STKDiscretization::getImplicitOverlapJacobianGraphT() const
 }
 #endif
 
+Teuchos::RCP<const Albany::JacobianAssemblyPlan>
+Albany::STKDiscretization::getJacobianAssemblyPlan() const
+{
+  // Side set equations only fill part of their rows, and Block CRS storage
+  // does not scatter into the point Jacobian at all.
+  if (!stkMeshStruct->useJacobianAssemblyPlan || sideSetEquations.size()>0 ||
+      Teuchos::nonnull(overlap_node_graphT) || Teuchos::is_null(overlap_graphT))
+    return Teuchos::null;
+
+  if (Teuchos::is_null(jacAssemblyPlan))
+    jacAssemblyPlan = Teuchos::rcp(new JacobianAssemblyPlan(*overlap_graphT, wsElNodeEqID));
+  return jacAssemblyPlan;
+}
+
 #if defined(ALBANY_EPETRA)
 Teuchos::RCP<const Epetra_Map>
 Albany::STKDiscretization::getNodeMap() const
@@ -685,6 +712,7 @@ void Albany::STKDiscretization::writeSolution(const Epetra_Vector& soln, const d
    Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
    container->transferSolutionToCoords();
+   computeWorksetViews();
 
    if (!mesh_data.is_null()) {
      // Mesh coordinates have changed. Rewrite output file by deleting the mesh data object and recreate it
@@ -698,24 +726,7 @@ void Albany::STKDiscretization::writeSolution(const Epetra_Vector& soln, const d
 
      double time_label = monotonicTimeLabel(time);
 
-     mesh_data->begin_output_step(outputFileIdx, time_label);
-     int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-     // Writing mesh global variables
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     mesh_data->end_output_step(outputFileIdx);
-
-     if (mapT->getComm()->getRank()==0) {
-       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
-       if (time_label != time) *out << " with label " << time_label;
-       *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
-     }
+     writeExodusStep(time, time_label);
   }
   outputInterval++;
 
@@ -787,6 +798,7 @@ writeSolutionToFileT(const Tpetra_Vector& solnT, const double time,
    Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
    container->transferSolutionToCoords();
+   computeWorksetViews();
 
    if (!mesh_data.is_null()) {
      // Mesh coordinates have changed. Rewrite output file by deleting the mesh data object and recreate it
@@ -799,24 +811,9 @@ writeSolutionToFileT(const Tpetra_Vector& solnT, const double time,
 
    double time_label = monotonicTimeLabel(time);
 
-     mesh_data->begin_output_step(outputFileIdx, time_label);
-     int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-     // Writing mesh global variables
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     mesh_data->end_output_step(outputFileIdx);
-
-     if (mapT->getComm()->getRank()==0) {
-       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
-       if (time_label != time) *out << " with label " << time_label;
-       *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
-     }
+     util::ProfileGuard guard("STK Output: Exodus",
+                              solnT.getLocalLength() * sizeof(ST));
+     writeExodusStep(time, time_label);
    }
    if (stkMeshStruct->cdfOutput && !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
 
@@ -864,6 +861,7 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
    Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
    container->transferSolutionToCoords();
+   computeWorksetViews();
 
    if (!mesh_data.is_null()) {
      // Mesh coordinates have changed. Rewrite output file by deleting the mesh data object and recreate it
@@ -876,24 +874,7 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
 
    double time_label = monotonicTimeLabel(time);
 
-     mesh_data->begin_output_step(outputFileIdx, time_label);
-     int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-     // Writing mesh global variables
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     mesh_data->end_output_step(outputFileIdx);
-
-     if (mapT->getComm()->getRank()==0) {
-       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
-       if (time_label != time) *out << " with label " << time_label;
-       *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
-     }
+     writeExodusStep(time, time_label);
    }
    if (stkMeshStruct->cdfOutput && !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
 
@@ -1561,16 +1542,10 @@ void Albany::STKDiscretization::computeGraphs()
 
 void Albany::STKDiscretization::computeGraphsUpToFillComplete()
 {
-  std::map<int, stk::mesh::Part*>::iterator pv = stkMeshStruct->partVec.begin();
-  int nodes_per_element =  metaData.get_cell_topology(*(pv->second)).getNodeCount();
-// int nodes_per_element_est =  metaData.get_cell_topology(*(stkMeshStruct->partVec[0])).getNodeCount();
-
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map, coordinates, graphs
 
   overlap_graphT = Teuchos::null; // delete existing graph happens here on remesh
 
-  overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, neq*nodes_per_element));
-
   stk::mesh::Selector select_owned_in_part =
     stk::mesh::Selector( metaData.universal_part() ) &
     stk::mesh::Selector( metaData.locally_owned_part() );
@@ -1582,8 +1557,8 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
   if (commT->getRank()==0)
     *out << "STKDisc: " << cells.size() << " elements on Proc 0 " << std::endl;
 
-  GO row, col;
-  Teuchos::ArrayView<GO> colAV;
+  overlap_node_graphT = Teuchos::null;
+  if (explicit_scheme) return;
 
   // determining the equations that are defined on the whole domain
   std::vector<int> globalEqns;
@@ -1595,6 +1570,75 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
     }
   }
 
+  const std::string& method = stkMeshStruct->jacobianGraphConstruction;
+  if (method == "Entry-wise") {
+    computeOverlapGraphEntryWise(globalEqns);
+  }
+  else if (method == "Compare") {
+    Teuchos::Time entryWiseTime("Entry-wise"), rowWiseTime("Row-wise");
+
+    entryWiseTime.start();
+    computeOverlapGraphEntryWise(globalEqns);
+    overlap_graphT->fillComplete();
+    entryWiseTime.stop();
+    const size_t entryWiseEntries = overlap_graphT->getNodeNumEntries();
+
+    overlap_graphT = Teuchos::null;
+
+    // Timed with its fillComplete like the entry-wise graph, then built again
+    // unfilled: fillCompleteGraphs fills it, after any entries added later.
+    rowWiseTime.start();
+    computeOverlapGraphRowWise(globalEqns);
+    overlap_graphT->fillComplete();
+    rowWiseTime.stop();
+    const size_t rowWiseEntries = overlap_graphT->getNodeNumEntries();
+
+    overlap_graphT = Teuchos::null;
+    computeOverlapGraphRowWise(globalEqns);
+
+    TEUCHOS_TEST_FOR_EXCEPTION(entryWiseEntries != rowWiseEntries, std::logic_error,
+      "STKDisc: Row-wise Jacobian graph has " << rowWiseEntries
+      << " local entries, Entry-wise graph has " << entryWiseEntries << std::endl);
+
+    double times[2] = {entryWiseTime.totalElapsedTime(), rowWiseTime.totalElapsedTime()};
+    double maxTimes[2];
+    Teuchos::reduceAll<int, double>(*commT, Teuchos::REDUCE_MAX, 2, times, maxTimes);
+    *out << "STKDisc: Jacobian graph construction (max over ranks, "
+         << rowWiseEntries << " local entries on this rank)\n"
+         << "  Entry-wise (incl. fillComplete): " << maxTimes[0] << " s\n"
+         << "  Row-wise (incl. fillComplete):   " << maxTimes[1] << " s" << std::endl;
+  }
+  else {
+    TEUCHOS_TEST_FOR_EXCEPTION(method != "Row-wise" && !method.empty(), std::logic_error,
+      "STKDisc: Unknown Jacobian Graph Construction " << method
+      << ". Valid choices are Row-wise, Entry-wise and Compare." << std::endl);
+    computeOverlapGraphRowWise(globalEqns);
+  }
+
+  const std::string& storage = stkMeshStruct->jacobianStorage;
+  if (storage == "Block CRS") {
+    computeOverlapNodeGraph();
+  }
+  else {
+    TEUCHOS_TEST_FOR_EXCEPTION(storage != "Point CRS" && !storage.empty(), std::logic_error,
+      "STKDisc: Unknown Jacobian Storage " << storage
+      << ". Valid choices are Point CRS and Block CRS." << std::endl);
+  }
+}
+
+void Albany::STKDiscretization::computeOverlapGraphEntryWise(const std::vector<int>& globalEqns)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany: STKDisc Jacobian Graph (Entry-wise)");
+
+  std::map<int, stk::mesh::Part*>::iterator pv = stkMeshStruct->partVec.begin();
+  int nodes_per_element =  metaData.get_cell_topology(*(pv->second)).getNodeCount();
+// int nodes_per_element_est =  metaData.get_cell_topology(*(stkMeshStruct->partVec[0])).getNodeCount();
+
+  overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, neq*nodes_per_element));
+
+  GO row, col;
+  Teuchos::ArrayView<GO> colAV;
+
   for (std::size_t i=0; i < cells.size(); i++) {
     stk::mesh::Entity e = cells[i];
     stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
@@ -1689,12 +1733,166 @@ void Albany::STKDiscretization::computeGraphsUpToFillComplete()
   }
 }
 
+namespace {
+// Sort the neighbor lists and drop duplicates
+void uniqueAdjacency (std::vector<std::vector<GO> >& adj)
+{
+  for (std::size_t i=0; i < adj.size(); ++i) {
+    std::sort(adj[i].begin(), adj[i].end());
+    adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+  }
+}
+} // namespace
+
+void Albany::STKDiscretization::computeNodeAdjacency(std::vector<std::vector<GO> >& nodeAdj) const
+{
+  nodeAdj.assign(numOverlapNodes, std::vector<GO>());
+  for (std::size_t i=0; i < cells.size(); i++) {
+    stk::mesh::Entity e = cells[i];
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
+    const size_t num_nodes = bulkData.num_nodes(e);
+    for (std::size_t j=0; j < num_nodes; j++) {
+      std::vector<GO>& adj = nodeAdj[overlap_node_mapT->getLocalElement(gid(node_rels[j]))];
+      for (std::size_t l=0; l < num_nodes; l++)
+        adj.push_back(gid(node_rels[l]));
+    }
+  }
+  uniqueAdjacency(nodeAdj);
+}
+
+void Albany::STKDiscretization::computeOverlapNodeGraph()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany: STKDisc Node Jacobian Graph");
+
+  // The block matrix addresses node (block) rows as DOF LID / neq, which
+  // only holds for interleaved ordering. Side set equations have a sparser
+  // pattern than the volume ones and cannot share one block.
+  TEUCHOS_TEST_FOR_EXCEPTION(!interleavedOrdering, std::logic_error,
+    "STKDisc: Block CRS Jacobian storage requires Interleaved Ordering." << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(sideSetEquations.size()>0, std::logic_error,
+    "STKDisc: Block CRS Jacobian storage does not support side set equations." << std::endl);
+
+  std::vector<std::vector<GO> > nodeAdj;
+  computeNodeAdjacency(nodeAdj);
+
+  Teuchos::ArrayRCP<size_t> numEntriesPerRow(numOverlapNodes);
+  for (int inode=0; inode < numOverlapNodes; ++inode)
+    numEntriesPerRow[inode] = nodeAdj[inode].size();
+
+  overlap_node_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_node_mapT, numEntriesPerRow, Tpetra::StaticProfile));
+  for (int inode=0; inode < numOverlapNodes; ++inode)
+    if (!nodeAdj[inode].empty())
+      overlap_node_graphT->insertGlobalIndices(overlap_node_mapT->getGlobalElement(inode),
+                                               Teuchos::arrayViewFromVector(nodeAdj[inode]));
+}
+
+void Albany::STKDiscretization::computeOverlapGraphRowWise(const std::vector<int>& globalEqns)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany: STKDisc Jacobian Graph (Row-wise)");
+
+  // Every (row node, eq) pair couples to every (col node, m) pair, so the
+  // DOF graph is the node adjacency expanded by the neq block.
+  std::vector<std::vector<GO> > nodeAdj;
+  computeNodeAdjacency(nodeAdj);
+
+  // Same for the side-set equations, one adjacency per equation. The diagonal
+  // entry is always present, since some problems only have side set eqns.
+  std::map<int, std::vector<std::vector<GO> > > sideNodeAdj;
+  std::map<int,std::vector<std::string> >::const_iterator it;
+  for (it=sideSetEquations.begin(); it!=sideSetEquations.end(); ++it)
+  {
+    std::vector<std::vector<GO> >& adj = sideNodeAdj[it->first];
+    adj.resize(numOverlapNodes);
+
+    for (int ss(0); ss<it->second.size(); ++ss)
+    {
+      stk::mesh::Part& part = *stkMeshStruct->ssPartVec.find(it->second[ss])->second;
+      stk::mesh::Selector select_owned_in_sspart = stk::mesh::Selector( part ) & stk::mesh::Selector( metaData.locally_owned_part() );
+
+      std::vector< stk::mesh::Entity > sides;
+      stk::mesh::get_selected_entities( select_owned_in_sspart, bulkData.buckets( metaData.side_rank() ), sides );
+
+      for (std::size_t localSideID=0; localSideID < sides.size(); localSideID++)
+      {
+        stk::mesh::Entity sidee = sides[localSideID];
+        stk::mesh::Entity const* node_rels = bulkData.begin_nodes(sidee);
+        const size_t num_nodes = bulkData.num_nodes(sidee);
+        for (std::size_t i=0; i < num_nodes; i++) {
+          std::vector<GO>& nadj = adj[overlap_node_mapT->getLocalElement(gid(node_rels[i]))];
+          for (std::size_t j=0; j < num_nodes; j++)
+            nadj.push_back(gid(node_rels[j]));
+        }
+      }
+    }
+    uniqueAdjacency(adj);
+  }
+
+  // Exact number of entries of every overlap row.
+  Teuchos::ArrayRCP<size_t> numEntriesPerRow(overlap_mapT->getNodeNumElements(), 0);
+  for (int inode=0; inode < numOverlapNodes; ++inode) {
+    const GO node_gid = gid(overlapnodes[inode]);
+    const std::vector<GO>& adj = nodeAdj[overlap_node_mapT->getLocalElement(node_gid)];
+    for (std::size_t k=0; k < globalEqns.size(); ++k)
+      numEntriesPerRow[overlap_mapT->getLocalElement(getGlobalDOF(node_gid, globalEqns[k]))] = adj.size()*neq;
+
+    std::map<int, std::vector<std::vector<GO> > >::const_iterator sit;
+    for (sit=sideNodeAdj.begin(); sit!=sideNodeAdj.end(); ++sit) {
+      const std::vector<GO>& sadj = sit->second[overlap_node_mapT->getLocalElement(node_gid)];
+      const bool hasDiag = std::binary_search(sadj.begin(), sadj.end(), node_gid);
+      numEntriesPerRow[overlap_mapT->getLocalElement(getGlobalDOF(node_gid, sit->first))] =
+        sadj.size()*neq + (hasDiag ? 0 : 1);
+    }
+  }
+
+#if defined(ALBANY_PERIDIGM)
+  // Peridigm adds its own nonzeros after this call
+  const Tpetra::ProfileType profile = Tpetra::DynamicProfile;
+#else
+  const Tpetra::ProfileType profile = Tpetra::StaticProfile;
+#endif
+  overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, numEntriesPerRow, profile));
+
+  // Insert every row once.
+  std::vector<GO> cols;
+  for (int inode=0; inode < numOverlapNodes; ++inode) {
+    const GO node_gid = gid(overlapnodes[inode]);
+    const std::vector<GO>& adj = nodeAdj[overlap_node_mapT->getLocalElement(node_gid)];
+
+    if (!adj.empty()) {
+      cols.resize(adj.size()*neq);
+      for (std::size_t l=0; l < adj.size(); ++l)
+        for (std::size_t m=0; m < neq; ++m)
+          cols[l*neq + m] = getGlobalDOF(adj[l], m);
+      for (std::size_t k=0; k < globalEqns.size(); ++k)
+        overlap_graphT->insertGlobalIndices(getGlobalDOF(node_gid, globalEqns[k]),
+                                            Teuchos::arrayViewFromVector(cols));
+    }
+
+    std::map<int, std::vector<std::vector<GO> > >::const_iterator sit;
+    for (sit=sideNodeAdj.begin(); sit!=sideNodeAdj.end(); ++sit) {
+      const std::vector<GO>& sadj = sit->second[overlap_node_mapT->getLocalElement(node_gid)];
+      const GO row = getGlobalDOF(node_gid, sit->first);
+      cols.resize(sadj.size()*neq);
+      for (std::size_t l=0; l < sadj.size(); ++l)
+        for (std::size_t m=0; m < neq; ++m)
+          cols[l*neq + m] = getGlobalDOF(sadj[l], m);
+      if (!std::binary_search(sadj.begin(), sadj.end(), node_gid))
+        cols.push_back(row);
+      overlap_graphT->insertGlobalIndices(row, Teuchos::arrayViewFromVector(cols));
+    }
+  }
+}
+
 void Albany::STKDiscretization::fillCompleteGraphs()
 {
-  overlap_graphT->fillComplete();
+  jacAssemblyPlan = Teuchos::null;
 
   // Create Owned graph by exporting overlap with known row map
   graphT = Teuchos::null; // delete existing graph happens here on remesh
+  node_graphT = Teuchos::null;
+  if (explicit_scheme) return;
+
+  overlap_graphT->fillComplete();
 
   graphT = Teuchos::rcp(new Tpetra_CrsGraph(mapT, nonzeroesPerRow(neq)));
 
@@ -1702,6 +1900,15 @@ void Albany::STKDiscretization::fillCompleteGraphs()
   Teuchos::RCP<Tpetra_Export> exporterT = Teuchos::rcp(new Tpetra_Export(overlap_mapT, mapT));
   graphT->doExport(*overlap_graphT, *exporterT, Tpetra::INSERT);
   graphT->fillComplete();
+
+  if (Teuchos::nonnull(overlap_node_graphT)) {
+    overlap_node_graphT->fillComplete();
+
+    node_graphT = Teuchos::rcp(new Tpetra_CrsGraph(node_mapT, nonzeroesPerRow(1)));
+    Teuchos::RCP<Tpetra_Export> nodeExporterT = Teuchos::rcp(new Tpetra_Export(overlap_node_mapT, node_mapT));
+    node_graphT->doExport(*overlap_node_graphT, *nodeExporterT, Tpetra::INSERT);
+    node_graphT->fillComplete();
+  }
 }
 
 void Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
@@ -1751,6 +1958,37 @@ void Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
 #endif
 }
 
+void Albany::STKDiscretization::computeWorksetViews()
+{
+  const int numBuckets = wsElNodeEqID.size();
+  wsElNodeEqIDView.resize(numBuckets);
+
+  for (int b=0; b < numBuckets; b++) {
+    const int numCells = wsElNodeEqID[b].size();
+    const int numNodes = numCells > 0 ? wsElNodeEqID[b][0].size() : 0;
+
+    wsElNodeEqIDView[b] = WsElNodeEqIDView("wsElNodeEqID", numCells, numNodes, neq);
+    WsElNodeEqIDView::HostMirror eqID = Kokkos::create_mirror_view(wsElNodeEqIDView[b]);
+    for (int i=0; i < numCells; i++)
+      for (int j=0; j < numNodes; j++)
+        for (int eq=0; eq < neq; eq++)
+          eqID(i,j,eq) = wsElNodeEqID[b][i][j][eq];
+    Kokkos::deep_copy(wsElNodeEqIDView[b], eqID);
+  }
+}
+
+void Albany::STKDiscretization::computeLayeredColumns()
+{
+  wsLayeredColumns.clear();
+  const Teuchos::RCP<LayeredMeshNumbering<LO> >& numbering = stkMeshStruct->layered_mesh_numbering;
+  if (numbering.is_null()) return;
+
+  const int numBuckets = wsElNodeID.size();
+  wsLayeredColumns.resize(numBuckets);
+  for (int b=0; b < numBuckets; b++)
+    wsLayeredColumns[b] = LayeredColumns(*numbering, *overlap_node_mapT, wsElNodeID[b]);
+}
+
 void Albany::STKDiscretization::computeWorksetInfo()
 {
 
@@ -2005,9 +2243,6 @@ void Albany::STKDiscretization::computeWorksetInfo()
 */
     }
   }
-//Kopy workset to the Kokkos data
- //wsElNodeEqID_kokkos=Kokkos::View<int****, PHX::Device>("wsElNodeEqID_kokkos",numBuckets,wsElNodeEqID[0].size(),wsElNodeEqID[0][0].size(), neq);
-
 
  for (int d=0; d<stkMeshStruct->numDim; d++) {
   if (stkMeshStruct->PBCStruct.periodic[d]) {
@@ -2048,6 +2283,11 @@ void Albany::STKDiscretization::computeWorksetInfo()
   }
   }
 
+  // Contiguous copies for the gather/scatter evaluators; after the periodic
+  // fix-up above, which may replace coordinate pointers.
+  computeWorksetViews();
+  computeLayeredColumns();
+
   typedef Albany::AbstractSTKFieldContainer::ScalarValueState ScalarValueState;
   typedef Albany::AbstractSTKFieldContainer::QPScalarState QPScalarState;
   typedef Albany::AbstractSTKFieldContainer::QPVectorState QPVectorState;
@@ -2423,9 +2663,73 @@ void Albany::STKDiscretization::computeNodeSets()
   }
 }
 
+void Albany::STKDiscretization::flushOutput()
+{
+#ifdef ALBANY_SEACAS
+  if (Teuchos::nonnull(asyncWriter))
+    asyncWriter->wait();
+#endif
+}
+
+#ifdef ALBANY_SEACAS
+void Albany::STKDiscretization::
+writeExodusStep(const double time, const double time_label)
+{
+  Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
+
+  if (Teuchos::nonnull(asyncWriter)) {
+    // The staging fields are free once the previous step is written.
+    asyncWriter->wait();
+    for (const auto& fields : stkMeshStruct->asyncOutputFields) {
+      const stk::mesh::BucketVector& buckets =
+        bulkData.buckets(fields.first->entity_rank());
+      for (size_t b = 0; b < buckets.size(); ++b) {
+        const size_t bytes =
+          stk::mesh::field_bytes_per_entity(*fields.first, *buckets[b]) * buckets[b]->size();
+        if (bytes == 0) continue;
+        std::memcpy(stk::mesh::field_data(*fields.second, *buckets[b]),
+                    stk::mesh::field_data(*fields.first, *buckets[b]), bytes);
+      }
+    }
+    asyncWriter->write(time_label, container->getMeshVectorStates(),
+                       container->getMeshScalarIntegerStates());
+
+    if (mapT->getComm()->getRank()==0) {
+      *out << "Albany::STKDiscretization::writeSolution: queued time " << time;
+      if (time_label != time) *out << " with label " << time_label;
+      *out << " for file " << stkMeshStruct->exoOutFile << std::endl;
+    }
+    return;
+  }
+
+  mesh_data->begin_output_step(outputFileIdx, time_label);
+  int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
+  // Writing mesh global variables
+  for (auto& it : container->getMeshVectorStates())
+  {
+    mesh_data->write_global (outputFileIdx, it.first, it.second);
+  }
+  for (auto& it : container->getMeshScalarIntegerStates())
+  {
+    mesh_data->write_global (outputFileIdx, it.first, it.second);
+  }
+  mesh_data->end_output_step(outputFileIdx);
+
+  if (mapT->getComm()->getRank()==0) {
+    *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
+    if (time_label != time) *out << " with label " << time_label;
+    *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
+  }
+}
+#endif
+
 void Albany::STKDiscretization::setupExodusOutput()
 {
 #ifdef ALBANY_SEACAS
+  // Finish any step still being written to the previous output mesh.
+  flushOutput();
+  asyncWriter = Teuchos::null;
+
   if (stkMeshStruct->exoOutput) {
 
     outputInterval = 0;
@@ -2450,8 +2754,20 @@ void Albany::STKDiscretization::setupExodusOutput()
       mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
     }
 
+    // With asynchronous output the staging copies are written under the
+    // names of the fields they copy. The mesh struct only declares them
+    // when the writer thread can run.
+    const bool async = stkMeshStruct->asyncExoOutput;
+    std::set<const stk::mesh::FieldBase*> skip;
+    for (const auto& it : stkMeshStruct->asyncOutputFields) {
+      mesh_data->add_field(outputFileIdx, *it.second, it.first->name());
+      skip.insert(it.second);
+      skip.insert(it.first);
+    }
+
     const stk::mesh::FieldVector &fields = mesh_data->meta_data().get_fields();
     for (size_t i=0; i < fields.size(); i++) {
+      if (skip.count(fields[i])) continue;
       // Hacky, but doesn't appear to be a way to query if a field is already
       // going to be output.
       try {
@@ -2459,6 +2775,9 @@ void Albany::STKDiscretization::setupExodusOutput()
       }
       catch (std::runtime_error const&) { }
     }
+
+    if (async)
+      asyncWriter = Teuchos::rcp(new AsyncExodusWriter(mesh_data, outputFileIdx));
   }
 #else
   if (stkMeshStruct->exoOutput)
@@ -3007,6 +3326,8 @@ void Albany::STKDiscretization::reNameExodusOutput(std::string& filename)
 #ifdef ALBANY_SEACAS
   if (stkMeshStruct->exoOutput && !mesh_data.is_null()) {
     // Delete the mesh data object and recreate it
+    flushOutput();
+    asyncWriter = Teuchos::null;
     mesh_data = Teuchos::null;
 
     stkMeshStruct->exoOutFile = filename;
@@ -3275,6 +3596,11 @@ void Albany::STKDiscretization::buildSideSetProjectors()
 void
 Albany::STKDiscretization::updateMesh(bool /*shouldTransferIPData*/)
 {
+  ++meshGeneration;
+
+  // The assembly plan refers to the old graph and worksets
+  jacAssemblyPlan = Teuchos::null;
+
   const Albany::StateInfoStruct& nodal_param_states = stkMeshStruct->getFieldContainer()->getNodalParameterSIS();
   nodalDOFsStructContainer.addEmptyDOFsStruct("ordinary_solution", "", neq);
   nodalDOFsStructContainer.addEmptyDOFsStruct("mesh_nodes", "", 1);
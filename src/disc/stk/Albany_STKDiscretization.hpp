@@ -36,6 +36,7 @@
 #include <stk_mesh/base/FieldTraits.hpp>
 #ifdef ALBANY_SEACAS
   #include <stk_io/StkMeshIoBroker.hpp>
+  #include "Albany_AsyncExodusWriter.hpp"
 #endif
 
 
@@ -81,7 +82,8 @@ namespace Albany {
        Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct,
        const Teuchos::RCP<const Teuchos_Comm>& commT,
        const Teuchos::RCP<Albany::RigidBodyModes>& rigidBodyModes = Teuchos::null,
-       const std::map<int,std::vector<std::string> >& sideSetEquations = std::map<int,std::vector<std::string> >());
+       const std::map<int,std::vector<std::string> >& sideSetEquations = std::map<int,std::vector<std::string> >(),
+       const bool explicit_scheme = false);
 
     //! Destructor
     ~STKDiscretization();
@@ -147,6 +149,15 @@ namespace Albany {
 #endif
     //! Get Tpetra overlap Jacobian graph
     Teuchos::RCP<const Tpetra_CrsGraph> getOverlapJacobianGraphT() const;
+
+    //! Get node-to-node Tpetra Jacobian graph (Block CRS storage only)
+    Teuchos::RCP<const Tpetra_CrsGraph> getNodeJacobianGraphT() const { return node_graphT; }
+
+    //! Get node-to-node Tpetra overlap Jacobian graph (Block CRS storage only)
+    Teuchos::RCP<const Tpetra_CrsGraph> getOverlapNodeJacobianGraphT() const { return overlap_node_graphT; }
+
+    //! Get the Jacobian assembly plan, built on first use ("Jacobian Assembly Plan" only)
+    Teuchos::RCP<const JacobianAssemblyPlan> getJacobianAssemblyPlan() const;
 #ifdef ALBANY_AERAS
     //! Get Tpetra implicit overlap Jacobian graph (for Aeras)
     Teuchos::RCP<const Tpetra_CrsGraph> getImplicitOverlapJacobianGraphT() const;
@@ -166,7 +177,8 @@ namespace Albany {
     //! Get overlapped Node map
     Teuchos::RCP<const Tpetra_Map> getOverlapNodeMapT() const;
     
-    bool isExplicitScheme() const { return false; }
+    //! No Jacobian graphs are built for explicit time integration
+    bool isExplicitScheme() const { return explicit_scheme; }
 
     //! Get Node set lists (typedef in Albany_AbstractDiscretization.hpp)
     const NodeSetList& getNodeSets() const { return nodeSets; };
@@ -182,6 +194,8 @@ namespace Albany {
 
     //! Get map from (Ws, El, Local Node) -> NodeLID
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> > > >::type& getWsElNodeEqID() const;
+    const Albany::WorksetArray<WsElNodeEqIDView>::type& getWsElNodeEqIDView() const
+      { return wsElNodeEqIDView; }
 
     //! Get map from (Ws, Local Node) -> NodeGID
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type& getWsElNodeID() const;
@@ -202,6 +216,9 @@ namespace Albany {
     void setReferenceConfigurationManager(const Teuchos::RCP<AAdapt::rc::Manager>& rcm);
 
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type& getCoords() const;
+    //! Basal columns of each workset, built with the worksets of a layered mesh
+    const Albany::WorksetArray<LayeredColumns>::type& getWsLayeredColumns() const
+      { return wsLayeredColumns; }
     const Albany::WorksetArray<Teuchos::ArrayRCP<double> >::type& getSphereVolume() const;
     const Albany::WorksetArray<Teuchos::ArrayRCP<double*> >::type& getLatticeOrientation() const;
 
@@ -232,6 +249,9 @@ namespace Albany {
    void writeSolutionToFileT(const Tpetra_Vector& solnT, const double time, const bool overlapped = false);
    void writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time, const bool overlapped = false);
 
+   //! Wait for the asynchronous exodus writer, rethrowing its errors
+   void flushOutput();
+
 #if defined(ALBANY_EPETRA)
     Teuchos::RCP<Epetra_Vector> getSolutionField(const bool overlapped=false) const;
 #endif
@@ -385,6 +405,11 @@ namespace Albany {
     void computeOverlapNodesAndUnknowns();
     //! Process STK mesh for Workset/Bucket Info
     void computeWorksetInfo();
+    //! Build the contiguous connectivity and coordinate views per workset
+    void computeWorksetViews();
+
+    //! Map the nodes of each workset to their basal columns (layered meshes only)
+    void computeLayeredColumns();
     //! Process STK mesh for NodeSets
     void computeNodeSets();
     //! Process STK mesh for SideSets
@@ -393,6 +418,10 @@ namespace Albany {
     void computeNodeSetsFromSideSets();
     //! Call stk_io for creating exodus output file
     void setupExodusOutput();
+#ifdef ALBANY_SEACAS
+    //! Write (or queue, with asynchronous output) one exodus output step
+    void writeExodusStep(const double time, const double time_label);
+#endif
     //! Call stk_io for creating NetCDF output file
     void setupNetCDFOutput();
 #if defined(ALBANY_EPETRA)
@@ -462,6 +491,13 @@ namespace Albany {
     //! Overlapped Jacobian matrix graph
     Teuchos::RCP<Tpetra_CrsGraph> overlap_graphT;
 
+    //! Node-to-node Jacobian graphs, built for Block CRS storage only
+    Teuchos::RCP<Tpetra_CrsGraph> node_graphT;
+    Teuchos::RCP<Tpetra_CrsGraph> overlap_node_graphT;
+
+    //! Cached Jacobian assembly plan, dropped whenever the graphs are rebuilt
+    mutable Teuchos::RCP<const JacobianAssemblyPlan> jacAssemblyPlan;
+
     //! Processor ID
     unsigned int myPID;
 
@@ -493,6 +529,9 @@ namespace Albany {
     Albany::WorksetArray<std::string>::type wsEBNames;
     Albany::WorksetArray<int>::type wsPhysIndex;
     Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type coords;
+    //! Contiguous copy of wsElNodeEqID
+    Albany::WorksetArray<WsElNodeEqIDView>::type wsElNodeEqIDView;
+    Albany::WorksetArray<LayeredColumns>::type wsLayeredColumns;
     Albany::WorksetArray<Teuchos::ArrayRCP<double> >::type sphereVolume;
     Albany::WorksetArray<Teuchos::ArrayRCP<double*> >::type latticeOrientation;
 
@@ -547,9 +586,16 @@ namespace Albany {
     int outputInterval;
 
     size_t outputFileIdx;
+
+    //! Background writer of the exodus steps, if asynchronous output is on;
+    //! declared after mesh_data so that it is destroyed first
+    Teuchos::RCP<AsyncExodusWriter> asyncWriter;
 #endif
     bool interleavedOrdering;
 
+    //! Explicit time integration: the Jacobian graphs stay null
+    const bool explicit_scheme;
+
   private:
 
     Teuchos::RCP<Tpetra_CrsGraph> nodalGraph;
@@ -592,6 +638,15 @@ namespace Albany {
     void computeGraphsUpToFillComplete();
     void fillCompleteGraphs();
 
+    //! Build overlap_graphT by inserting one (row, col) entry at a time
+    void computeOverlapGraphEntryWise(const std::vector<int>& globalEqns);
+    //! Build overlap_graphT from precomputed node adjacency, inserting each row once
+    void computeOverlapGraphRowWise(const std::vector<int>& globalEqns);
+    //! Node-to-node adjacency of the owned cells, indexed by overlap node LID
+    void computeNodeAdjacency(std::vector<std::vector<GO> >& nodeAdj) const;
+    //! Build overlap_node_graphT for Block CRS Jacobian storage
+    void computeOverlapNodeGraph();
+
   };
 
 }
@@ -17,6 +17,9 @@ namespace PHAL {
 
     This evaluator interpolates nodal DOF values to quad points.
 
+    With "Fused Interpolation", U, its time derivative and the gradient
+    of its first component are interpolated from the gathered nodal values
+    inside the residual loop, in place of the interpolation evaluators.
 */
 
 template<typename EvalT, typename Traits>
@@ -34,6 +37,8 @@ public:
 
 private:
 
+  void evaluateFused(typename Traits::EvalData d);
+
   typedef typename EvalT::ScalarT ScalarT;
   typedef typename EvalT::MeshScalarT MeshScalarT;
 
@@ -44,6 +49,12 @@ private:
   PHX::MDField<ScalarT,Cell,QuadPoint,VecDim> U; 
   PHX::MDField<ScalarT,Cell,QuadPoint,VecDim,Dim> UGrad;
   PHX::MDField<ScalarT,Cell,QuadPoint,VecDim> UDot;
+
+  // Input for the fused interpolation:
+  PHX::MDField<ScalarT,Cell,Node,VecDim> UNode;
+  PHX::MDField<ScalarT,Cell,Node,VecDim> UDotNode;
+  PHX::MDField<MeshScalarT,Cell,Node,QuadPoint> BF;
+  PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
   
   double mu;   //viscosity coefficient
   double a;    //advection coefficient
@@ -60,6 +71,7 @@ private:
   std::size_t numDims;
   std::size_t vecDim;
   bool enableTransient;
+  bool fused;
 };
 }
 
@@ -28,14 +28,35 @@ AdvDiffResid(const Teuchos::ParameterList& p) :
   UDot       (p.get<std::string>                   ("QP Time Derivative Variable Name"),
 	       p.get<Teuchos::RCP<PHX::DataLayout> >("QP Vector Data Layout") ),
   Residual   (p.get<std::string>                   ("Residual Name"),
-              p.get<Teuchos::RCP<PHX::DataLayout> >("Node Vector Data Layout") ) 
+              p.get<Teuchos::RCP<PHX::DataLayout> >("Node Vector Data Layout") ),
+  fused(p.isType<bool>("Fused Interpolation") && p.get<bool>("Fused Interpolation"))
 {
 
 
-
-  this->addDependentField(U);
-  this->addDependentField(UGrad);
-  this->addDependentField(UDot);
+  if (fused) {
+    // The nodal values from the gather, under the same names
+    UNode = PHX::MDField<ScalarT,Cell,Node,VecDim>(
+        p.get<std::string>("QP Variable Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node Vector Data Layout"));
+    UDotNode = PHX::MDField<ScalarT,Cell,Node,VecDim>(
+        p.get<std::string>("QP Time Derivative Variable Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node Vector Data Layout"));
+    BF = PHX::MDField<MeshScalarT,Cell,Node,QuadPoint>(
+        p.get<std::string>("BF Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node QP Scalar Data Layout"));
+    GradBF = PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim>(
+        p.get<std::string>("Gradient BF Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node QP Gradient Data Layout"));
+    this->addDependentField(UNode);
+    this->addDependentField(UDotNode);
+    this->addDependentField(BF);
+    this->addDependentField(GradBF);
+  }
+  else {
+    this->addDependentField(U);
+    this->addDependentField(UGrad);
+    this->addDependentField(UDot);
+  }
   this->addDependentField(wBF);
   this->addDependentField(wGradBF);
 
@@ -89,9 +110,17 @@ void AdvDiffResid<EvalT, Traits>::
 postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
-  this->utils.setFieldData(U,fm);
-  this->utils.setFieldData(UGrad,fm);
-  this->utils.setFieldData(UDot,fm);
+  if (fused) {
+    this->utils.setFieldData(UNode,fm);
+    this->utils.setFieldData(UDotNode,fm);
+    this->utils.setFieldData(BF,fm);
+    this->utils.setFieldData(GradBF,fm);
+  }
+  else {
+    this->utils.setFieldData(U,fm);
+    this->utils.setFieldData(UGrad,fm);
+    this->utils.setFieldData(UDot,fm);
+  }
   this->utils.setFieldData(wBF,fm);
   this->utils.setFieldData(wGradBF,fm);
 
@@ -105,6 +134,11 @@ evaluateFields(typename Traits::EvalData workset)
 {
   typedef Intrepid2::FunctionSpaceTools FST;
 
+  if (fused) {
+    evaluateFused(workset);
+    return;
+  }
+
   if (useAugForm == false) { //standard form of advection-diffusion equation
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t node=0; node < numNodes; ++node) {
@@ -163,6 +197,72 @@ evaluateFields(typename Traits::EvalData workset)
     }
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void AdvDiffResid<EvalT, Traits>::
+evaluateFused(typename Traits::EvalData workset)
+{
+  // Quad point values live in these locals, one cell at a time:
+  // U_1, U_2, dU_0/dt and grad(U_0)
+  ScalarT q0, q1, UDot0, dUdx, dUdy;
+
+  for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+    for (std::size_t node=0; node < numNodes; ++node)
+      for (std::size_t i=0; i<vecDim; i++)
+        Residual(cell,node,i) = 0.0;
+
+    for (std::size_t qp=0; qp < numQPs; ++qp) {
+      UDot0 = UDotNode(cell,0,0) * BF(cell,0,qp);
+      dUdx = UNode(cell,0,0) * GradBF(cell,0,qp,0);
+      dUdy = UNode(cell,0,0) * GradBF(cell,0,qp,1);
+      for (std::size_t node=1; node < numNodes; ++node) {
+        UDot0 += UDotNode(cell,node,0) * BF(cell,node,qp);
+        dUdx += UNode(cell,node,0) * GradBF(cell,node,qp,0);
+        dUdy += UNode(cell,node,0) * GradBF(cell,node,qp,1);
+      }
+
+      if (useAugForm == false) {
+        //du/dt + a*du/dx + b*du/dy - mu*delta(u) = 0
+        for (std::size_t node=0; node < numNodes; ++node)
+          Residual(cell,node,0) += (UDot0 + a*dUdx + b*dUdy)*wBF(cell,node,qp) +
+                                   mu*dUdx*wGradBF(cell,node,qp,0) +
+                                   mu*dUdy*wGradBF(cell,node,qp,1);
+        continue;
+      }
+
+      q0 = UNode(cell,0,1) * BF(cell,0,qp);
+      q1 = UNode(cell,0,2) * BF(cell,0,qp);
+      for (std::size_t node=1; node < numNodes; ++node) {
+        q0 += UNode(cell,node,1) * BF(cell,node,qp);
+        q1 += UNode(cell,node,2) * BF(cell,node,qp);
+      }
+
+      if (formType == 1) {
+        for (std::size_t node=0; node < numNodes; ++node) {
+          //du/dt + (a,b).q - mu*div(q) = 0
+          Residual(cell,node,0) += (UDot0 + a*q0 + b*q1)*wBF(cell,node,qp) +
+                                   mu*q0*wGradBF(cell,node,qp,0) +
+                                   mu*q1*wGradBF(cell,node,qp,1);
+          //q - grad(u) = 0
+          Residual(cell,node,1) += (q0 - dUdx)*wBF(cell,node,qp);
+          Residual(cell,node,2) += (q1 - dUdy)*wBF(cell,node,qp);
+        }
+      }
+      else if (formType == 2) {
+        for (std::size_t node=0; node < numNodes; ++node) {
+          //du/dt + q = 0
+          Residual(cell,node,0) += (UDot0 + q0 + q1)*wBF(cell,node,qp);
+          //q - (a,b).grad(u) + mu*delta(u) = 0
+          Residual(cell,node,1) += (q0 - a*dUdx)*wBF(cell,node,qp)
+                                -  mu*dUdx*wGradBF(cell,node,qp,0);
+          Residual(cell,node,2) += (q1 - b*dUdy)*wBF(cell,node,qp)
+                                -  mu*dUdy*wGradBF(cell,node,qp,1);
+        }
+      }
+    }
+  }
+}
+
 //**********************************************************************
 }
 
@@ -173,6 +173,9 @@ class Dirichlet<PHAL::AlbanyTraits::MPJacobian,Traits>
 public:
   Dirichlet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
+private:
+  //! Tpetra ensemble fill
+  void evaluateFieldsT(typename Traits::EvalData d);
 };
 
 // **************************************************************
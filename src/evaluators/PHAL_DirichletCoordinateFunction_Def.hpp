@@ -89,6 +89,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "DirichletCoordFunction: not supported with Block CRS Jacobian storage." << std::endl);
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int> >& nsNodes =
@@ -475,6 +477,7 @@ DirichletCoordFunction(Teuchos::ParameterList& p) :
 template<typename Traits/*, typename cfunc_traits*/>
 void DirichletCoordFunction<PHAL::AlbanyTraits::MPResidual, Traits/*, cfunc_traits*/>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x =
@@ -506,6 +509,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletCoordFunction<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -520,6 +527,7 @@ DirichletCoordFunction(Teuchos::ParameterList& p) :
 template<typename Traits/*, typename cfunc_traits*/>
 void DirichletCoordFunction<PHAL::AlbanyTraits::MPJacobian, Traits/*, cfunc_traits*/>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > jac =
@@ -576,6 +584,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletCoordFunction<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -590,6 +602,7 @@ DirichletCoordFunction(Teuchos::ParameterList& p) :
 template<typename Traits/*, typename cfunc_traits*/>
 void DirichletCoordFunction<PHAL::AlbanyTraits::MPTangent, Traits/*, cfunc_traits*/>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> fp =
@@ -638,6 +651,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletCoordFunction<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -85,6 +85,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
+  TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::nonnull(dirichletWorkset.JacBlockT), std::logic_error,
+    "DirichletField: not supported with Block CRS Jacobian storage." << std::endl);
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
@@ -422,6 +424,7 @@ DirichletField(Teuchos::ParameterList& p) :
 template<typename Traits>
 void DirichletField<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Tpetra_Vector> pvecT =
     dirichletWorkset.distParamLib->get(this->field_name)->vector();
   Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
@@ -439,6 +442,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
         (*f)[block][lunk] = (*x)[block][lunk];
       if(nblock>0) (*f)[0][lunk] -= pT[lunk];
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletField<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -455,7 +462,7 @@ template<typename Traits>
 void DirichletField<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Tpetra_Vector> pvecT =
     dirichletWorkset.distParamLib->get(this->field_name)->vector();
   Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
@@ -495,6 +502,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
         if(nblock>0) (*f)[0][lunk] -= pT[lunk];
       }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletField<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -511,7 +522,7 @@ template<typename Traits>
 void DirichletField<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Tpetra_Vector> pvecT =
     dirichletWorkset.distParamLib->get(this->field_name)->vector();
   Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
@@ -549,6 +560,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
         for (int block=0; block<nblock; block++)
           (*fp)[block][i][lunk] = 0;
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "DirichletField<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -121,6 +121,34 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::ArrayRCP<ST> fT_nonconstView;
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
+  Teuchos::RCP<Tpetra_BlockCrsMatrix> jacBlockT = dirichletWorkset.JacBlockT;
+  if (Teuchos::nonnull(jacBlockT)) {
+    // Block CRS storage (interleaved ordering): zero the point row inside
+    // each block of the node row, then set the diagonal of the diagonal block.
+    const LO bs = jacBlockT->getBlockSize();
+    const Tpetra_CrsGraph& graphT = jacBlockT->getCrsGraph();
+    for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+      const LO lunk = nsNodes[inode][this->offset];
+      const LO blockRow = lunk / bs;
+      const LO eq = lunk % bs;
+      const LO diagCol = graphT.getColMap()->getLocalElement(
+        graphT.getRowMap()->getGlobalElement(blockRow));
+
+      const LO* blockCols;
+      ST* blockVals;
+      LO numBlocks;
+      jacBlockT->getLocalRowView(blockRow, blockCols, blockVals, numBlocks);
+      for (LO k = 0; k < numBlocks; ++k) {
+        ST* pointRow = blockVals + k*bs*bs + eq*bs;
+        for (LO c = 0; c < bs; ++c) pointRow[c] = 0.0;
+        if (blockCols[k] == diagCol) pointRow[eq] = j_coeff;
+      }
+
+      if (fillResid) fT_nonconstView[lunk] = xT_constView[lunk] - this->value.val();
+    }
+    return;
+  }
+
   Teuchos::Array<LO> index(1);
   Teuchos::Array<ST> value(1);
   size_t numEntriesT;
@@ -409,12 +437,29 @@ template<typename Traits>
 void Dirichlet<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+  const std::vector<std::vector<int> >& nsNodes =
+    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+
+  if (Teuchos::nonnull(dirichletWorkset.mp_fT)) {
+    // Tpetra ensemble fill: one column per sample
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT =
+      dirichletWorkset.mp_fT->get2dViewNonConst();
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT =
+      dirichletWorkset.mp_xT->get2dView();
+    const int nblock = xT.size();
+    for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+      const LO lunk = nsNodes[inode][this->offset];
+      for (int block=0; block<nblock; block++)
+        fT[block][lunk] = xT[block][lunk] - this->value.coeff(block);
+    }
+    return;
+  }
+
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<const Stokhos::ProductEpetraVector> x =
     dirichletWorkset.mp_x;
-  const std::vector<std::vector<int> >& nsNodes =
-    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
   int nblock = x->size();
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
@@ -422,6 +467,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
       for (int block=0; block<nblock; block++)
         (*f)[block][lunk] = ((*x)[block][lunk] - this->value.coeff(block));
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "Dirichlet<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -439,7 +488,12 @@ template<typename Traits>
 void Dirichlet<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
+  if (dirichletWorkset.mp_JacT.size() > 0) {
+    evaluateFieldsT(dirichletWorkset);
+    return;
+  }
 
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > jac =
@@ -475,6 +529,55 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
             (*x)[block][lunk] - this->value.val().coeff(block);
       }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "Dirichlet<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
+}
+
+// **********************************************************************
+template<typename Traits>
+void Dirichlet<PHAL::AlbanyTraits::MPJacobian, Traits>::
+evaluateFieldsT(typename Traits::EvalData dirichletWorkset)
+{
+  // Tpetra ensemble fill: one matrix and one residual column per sample
+  const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& jacT =
+    dirichletWorkset.mp_JacT;
+  const RealType j_coeff = dirichletWorkset.j_coeff;
+  const std::vector<std::vector<int> >& nsNodes =
+    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+
+  const bool fillResid = Teuchos::nonnull(dirichletWorkset.mp_fT);
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT;
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > xT;
+  if (fillResid) {
+    fT = dirichletWorkset.mp_fT->get2dViewNonConst();
+    xT = dirichletWorkset.mp_xT->get2dView();
+  }
+
+  Teuchos::Array<LO> index(1);
+  Teuchos::Array<ST> value(1, j_coeff);
+  Teuchos::Array<ST> matrixEntriesT;
+  Teuchos::Array<LO> matrixIndicesT;
+  size_t numEntriesT;
+
+  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+    const LO lunk = nsNodes[inode][this->offset];
+    index[0] = lunk;
+    for (int block=0; block<jacT.size(); block++) {
+      numEntriesT = jacT[block]->getNumEntriesInLocalRow(lunk);
+      matrixEntriesT.resize(numEntriesT);
+      matrixIndicesT.resize(numEntriesT);
+      jacT[block]->getLocalRowCopy(lunk, matrixIndicesT(), matrixEntriesT(), numEntriesT);
+      for (size_t i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
+      jacT[block]->replaceLocalValues(lunk, matrixIndicesT(), matrixEntriesT());
+      jacT[block]->replaceLocalValues(lunk, index(), value());
+    }
+    if (fillResid) {
+      for (int block=0; block<fT.size(); block++)
+        fT[block][lunk] = xT[block][lunk] - this->value.val().coeff(block);
+    }
+  }
 }
 
 // **********************************************************************
@@ -492,7 +595,7 @@ template<typename Traits>
 void Dirichlet<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<Stokhos::ProductEpetraVector> f =
     dirichletWorkset.mp_f;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> fp =
@@ -527,6 +630,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
           (*fp)[block][i][lunk] =
             -this->value.dx(dirichletWorkset.param_offset+i).coeff(block);
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "Dirichlet<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
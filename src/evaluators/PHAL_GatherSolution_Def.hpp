@@ -324,57 +324,52 @@ evaluateFields(typename Traits::EvalData workset)
 
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   if (this->tensorRank == 1) {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++) 
-          (this->valVec)(cell,node,eq) = xT_constView[eqID[this->offset + eq]];
+          (this->valVec)(cell,node,eq) = xT_constView[nodeID(cell,node,this->offset + eq)];
         if (workset.transientTerms && this->enableTransient) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->valVec_dot)(cell,node,eq) = xdotT_constView[eqID[this->offset + eq]];
+            (this->valVec_dot)(cell,node,eq) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
         if (workset.accelerationTerms && this->enableAcceleration) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->valVec_dotdot)(cell,node,eq) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->valVec_dotdot)(cell,node,eq) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     }
   } else 
   if (this->tensorRank == 2) {
     int numDim = this->valTensor.dimension(2);
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++) 
-          (this->valTensor)(cell,node,eq/numDim,eq%numDim) = xT_constView[eqID[this->offset + eq]];
+          (this->valTensor)(cell,node,eq/numDim,eq%numDim) = xT_constView[nodeID(cell,node,this->offset + eq)];
         if (workset.transientTerms && this->enableTransient) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) = xdotT_constView[eqID[this->offset + eq]];
+            (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
         if (workset.accelerationTerms && this->enableAcceleration) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     }
   } else {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++) 
-          (this->val[eq])(cell,node) = xT_constView[eqID[this->offset + eq]];
+          (this->val[eq])(cell,node) = xT_constView[nodeID(cell,node,this->offset + eq)];
         if (workset.transientTerms && this->enableTransient) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->val_dot[eq])(cell,node) = xdotT_constView[eqID[this->offset + eq]];
+            (this->val_dot[eq])(cell,node) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
         if (workset.accelerationTerms && this->enableAcceleration) {
           for (std::size_t eq = 0; eq < numFields; eq++) 
-            (this->val_dotdot[eq])(cell,node) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->val_dotdot[eq])(cell,node) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -665,20 +660,19 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if (this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-    const int neq = nodeID[0].size();
+    const int neq = nodeID.dimension(2);
     const std::size_t num_dof = neq * this->numNodes;
 
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
       int firstunk = neq * node + this->offset;
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
           valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xT_constView[eqID[this->offset + eq]]);
+        valref = FadType(valref.size(), xT_constView[nodeID(cell,node,this->offset + eq)]);
         // valref.setUpdateValue(!workset.ignore_residual); Not used anymore
         valref.fastAccessDx(firstunk + eq) = workset.j_coeff;
       }
@@ -688,7 +682,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref = (this->tensorRank == 0 ? this->val_dot[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec_dot(cell,node,eq) :
                     this->valTensor_dot(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xdotT_constView[eqID[this->offset + eq]]);
+        valref = FadType(valref.size(), xdotT_constView[nodeID(cell,node,this->offset + eq)]);
         valref.fastAccessDx(firstunk + eq) = workset.m_coeff;
         }
       }
@@ -698,7 +692,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref = (this->tensorRank == 0 ? this->val_dotdot[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec_dotdot(cell,node,eq) :
                     this->valTensor_dotdot(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xdotdotT_constView[eqID[this->offset + eq]]);
+        valref = FadType(valref.size(), xdotdotT_constView[nodeID(cell,node,this->offset + eq)]);
         valref.fastAccessDx(firstunk + eq) = workset.n_coeff;
         }
       }
@@ -811,24 +805,22 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
   
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
           valref = ((this->tensorRank == 2) ? (this->valTensor)(cell,node,eq/numDim,eq%numDim) :
                     (this->tensorRank == 1) ? (this->valVec)(cell,node,eq) :
                     (this->val[eq])(cell,node));
         if (VxT != Teuchos::null && workset.j_coeff != 0.0) {
-          valref = TanFadType(valref.size(), xT_constView[eqID[this->offset + eq]]);
+          valref = TanFadType(valref.size(), xT_constView[nodeID(cell,node,this->offset + eq)]);
           for (int k=0; k<workset.num_cols_x; k++)
             valref.fastAccessDx(k) =
-              workset.j_coeff*VxT->getData(k)[eqID[this->offset + eq]];
+              workset.j_coeff*VxT->getData(k)[nodeID(cell,node,this->offset + eq)];
         }
         else
-          valref = TanFadType(xT_constView[eqID[this->offset + eq]]);
+          valref = TanFadType(xT_constView[nodeID(cell,node,this->offset + eq)]);
       }
    }
 
@@ -836,17 +828,16 @@ evaluateFields(typename Traits::EvalData workset)
    if (workset.transientTerms && this->enableTransient) {
     Teuchos::ArrayRCP<const ST> xdotT_constView = xdotT->get1dView();
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
           valref = ((this->tensorRank == 2) ? (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) :
                     (this->tensorRank == 1) ? (this->valVec_dot)(cell,node,eq) :
                     (this->val_dot[eq])(cell,node));
-          valref = TanFadType(valref.size(), xdotT_constView[eqID[this->offset + eq]]);
+          valref = TanFadType(valref.size(), xdotT_constView[nodeID(cell,node,this->offset + eq)]);
           if (VxdotT != Teuchos::null && workset.m_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.m_coeff*VxdotT->getData(k)[eqID[this->offset + eq]];
+                workset.m_coeff*VxdotT->getData(k)[nodeID(cell,node,this->offset + eq)];
           }
         }
       }
@@ -855,18 +846,17 @@ evaluateFields(typename Traits::EvalData workset)
    if (workset.accelerationTerms && this->enableAcceleration) {
     Teuchos::ArrayRCP<const ST> xdotdotT_constView = xdotdotT->get1dView();
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
           valref = ((this->tensorRank == 2) ? (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim) :
                     (this->tensorRank == 1) ? (this->valVec_dotdot)(cell,node,eq) :
                     (this->val_dotdot[eq])(cell,node));
 
-          valref = TanFadType(valref.size(), xdotdotT_constView[eqID[this->offset + eq]]);
+          valref = TanFadType(valref.size(), xdotdotT_constView[nodeID(cell,node,this->offset + eq)]);
           if (VxdotdotT != Teuchos::null && workset.n_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.n_coeff*VxdotdotT->getData(k)[eqID[this->offset + eq]];
+                workset.n_coeff*VxdotdotT->getData(k)[nodeID(cell,node,this->offset + eq)];
           }
         }
       }
@@ -910,87 +900,75 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
 
   if (this->tensorRank == 1) {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++)
-          (this->valVec)(cell,node,eq) = xT_constView[eqID[this->offset + eq]];
+          (this->valVec)(cell,node,eq) = xT_constView[nodeID(cell,node,this->offset + eq)];
       }
 
     if (workset.transientTerms && this->enableTransient) {
     Teuchos::ArrayRCP<const ST> xdotT_constView = xdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->valVec_dot)(cell,node,eq) = xdotT_constView[eqID[this->offset + eq]];
+            (this->valVec_dot)(cell,node,eq) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
       }
     }
 
     if (workset.accelerationTerms && this->enableAcceleration) {
     Teuchos::ArrayRCP<const ST> xdotdotT_constView = xdotdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->valVec_dotdot)(cell,node,eq) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->valVec_dotdot)(cell,node,eq) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     } 
   } else
   if (this->tensorRank == 2) {
     int numDim = this->valTensor.dimension(2);
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++)
-          (this->valTensor)(cell,node,eq/numDim,eq%numDim) = xT_constView[eqID[this->offset + eq]];
+          (this->valTensor)(cell,node,eq/numDim,eq%numDim) = xT_constView[nodeID(cell,node,this->offset + eq)];
       }
 
     if (workset.transientTerms && this->enableTransient) {
     Teuchos::ArrayRCP<const ST> xdotT_constView = xdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) = xdotT_constView[eqID[this->offset + eq]];
+            (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
       }
     }
 
     if (workset.accelerationTerms && this->enableAcceleration) {
     Teuchos::ArrayRCP<const ST> xdotdotT_constView = xdotdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     }
   } else {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
         for (std::size_t eq = 0; eq < numFields; eq++)
-          (this->val[eq])(cell,node) = xT_constView[eqID[this->offset + eq]];
+          (this->val[eq])(cell,node) = xT_constView[nodeID(cell,node,this->offset + eq)];
       }
     if (workset.transientTerms && this->enableTransient) {
     Teuchos::ArrayRCP<const ST> xdotT_constView = xdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->val_dot[eq])(cell,node) = xdotT_constView[eqID[this->offset + eq]];
+            (this->val_dot[eq])(cell,node) = xdotT_constView[nodeID(cell,node,this->offset + eq)];
       }
     }
 
     if (workset.accelerationTerms && this->enableAcceleration) {
     Teuchos::ArrayRCP<const ST> xdotdotT_constView = xdotdotT->get1dView();
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const Teuchos::ArrayRCP<int>& eqID  = nodeID[node];
           for (std::size_t eq = 0; eq < numFields; eq++)
-            (this->val_dotdot[eq])(cell,node) = xdotdotT_constView[eqID[this->offset + eq]];
+            (this->val_dotdot[eq])(cell,node) = xdotdotT_constView[nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1039,9 +1017,8 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
 
   int nblock = x->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -1052,7 +1029,7 @@ evaluateFields(typename Traits::EvalData workset)
         valref.copyForWrite();
         for (int block=0; block<nblock; block++)
           valref.fastAccessCoeff(block) =
-            (*x)[block][nodeID[node][this->offset + eq]];
+            (*x)[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1064,7 +1041,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdot)[block][nodeID[node][this->offset + eq]];
+              (*xdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1077,7 +1054,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdotdot)[block][nodeID[node][this->offset + eq]];
+              (*xdotdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1126,11 +1103,10 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
 
   int nblock = x->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      int neq = nodeID[node].size();
+      int neq = nodeID.dimension(2);
       std::size_t num_dof = neq * this->numNodes;
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1144,7 +1120,7 @@ evaluateFields(typename Traits::EvalData workset)
         valref.val().reset(sg_expansion);
         valref.val().copyForWrite();
         for (int block=0; block<nblock; block++)
-          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID[node][this->offset + eq]];
+          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1157,7 +1133,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(sg_expansion);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1171,7 +1147,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(sg_expansion);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1227,9 +1203,8 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
  
   int nblock = x->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -1240,12 +1215,12 @@ evaluateFields(typename Traits::EvalData workset)
         if (Vx != Teuchos::null && workset.j_coeff != 0.0) {
           for (int k=0; k<workset.num_cols_x; k++)
             valref.fastAccessDx(k) =
-              workset.j_coeff*(*Vx)[k][nodeID[node][this->offset + eq]];
+              workset.j_coeff*(*Vx)[k][nodeID(cell,node,this->offset + eq)];
         }
         (valref.val()).reset(sg_expansion);
         (valref.val()).copyForWrite();
         for (int block=0; block<nblock; block++)
-          (valref.val()).fastAccessCoeff(block) = (*x)[block][nodeID[node][this->offset + eq]];
+          (valref.val()).fastAccessCoeff(block) = (*x)[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1257,12 +1232,12 @@ evaluateFields(typename Traits::EvalData workset)
           if (Vxdot != Teuchos::null && workset.m_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.m_coeff*(*Vxdot)[k][nodeID[node][this->offset + eq]];
+                workset.m_coeff*(*Vxdot)[k][nodeID(cell,node,this->offset + eq)];
           }
           valref.val().reset(sg_expansion);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1275,12 +1250,12 @@ evaluateFields(typename Traits::EvalData workset)
           if (Vxdotdot != Teuchos::null && workset.n_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.n_coeff*(*Vxdotdot)[k][nodeID[node][this->offset + eq]];
+                workset.n_coeff*(*Vxdotdot)[k][nodeID(cell,node,this->offset + eq)];
           }
           valref.val().reset(sg_expansion);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1293,6 +1268,36 @@ evaluateFields(typename Traits::EvalData workset)
 #endif 
 #ifdef ALBANY_ENSEMBLE 
 
+// **********************************************************************
+// Local values of each sample of the ensemble solution (order 0), its time
+// derivative (1) or its second time derivative (2): the Tpetra ensemble fill
+// sets the multivectors, the Epetra one the product vectors.
+inline int
+getEnsembleViews(const PHAL::Workset& workset, const int order,
+                 Teuchos::Array<Teuchos::ArrayRCP<const ST> >& views)
+{
+  const Teuchos::RCP<const Tpetra_MultiVector>& xT =
+    order == 0 ? workset.mp_xT : order == 1 ? workset.mp_xdotT : workset.mp_xdotdotT;
+  views.clear();
+  if (Teuchos::nonnull(xT)) {
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST> > cols = xT->get2dView();
+    views.assign(cols.begin(), cols.end());
+  }
+#if defined(ALBANY_EPETRA)
+  else {
+    const Teuchos::RCP<const Stokhos::ProductEpetraVector>& x =
+      order == 0 ? workset.mp_x : order == 1 ? workset.mp_xdot : workset.mp_xdotdot;
+    if (Teuchos::nonnull(x)) {
+      views.resize(x->size());
+      for (int block=0; block<x->size(); block++)
+        views[block] = Teuchos::arcp<const ST>((*x)[block].Values(), 0,
+                                               (*x)[block].MyLength(), false);
+    }
+  }
+#endif
+  return views.size();
+}
+
 // **********************************************************************
 // Specialization: Multi-point Residual
 // **********************************************************************
@@ -1319,19 +1324,16 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > x =
-    workset.mp_x;
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > xdot =
-    workset.mp_xdot;
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > xdotdot =
-    workset.mp_xdotdot;
+  Teuchos::Array<Teuchos::ArrayRCP<const ST> > x, xdot, xdotdot;
+  getEnsembleViews(workset, 0, x);
+  getEnsembleViews(workset, 1, xdot);
+  getEnsembleViews(workset, 2, xdotdot);
 
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
-  int nblock = x->size();
+  int nblock = x.size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -1342,7 +1344,7 @@ evaluateFields(typename Traits::EvalData workset)
         valref.copyForWrite();
         for (int block=0; block<nblock; block++)
           valref.fastAccessCoeff(block) =
-            (*x)[block][nodeID[node][this->offset + eq]];
+            x[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1354,7 +1356,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdot)[block][nodeID[node][this->offset + eq]];
+              xdot[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1367,7 +1369,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.copyForWrite();
           for (int block=0; block<nblock; block++)
             valref.fastAccessCoeff(block) =
-              (*xdotdot)[block][nodeID[node][this->offset + eq]];
+              xdotdot[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1403,21 +1405,18 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > x =
-    workset.mp_x;
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > xdot =
-    workset.mp_xdot;
-  Teuchos::RCP<const Stokhos::ProductEpetraVector > xdotdot =
-    workset.mp_xdotdot;
+  Teuchos::Array<Teuchos::ArrayRCP<const ST> > x, xdot, xdotdot;
+  getEnsembleViews(workset, 0, x);
+  getEnsembleViews(workset, 1, xdot);
+  getEnsembleViews(workset, 2, xdotdot);
 
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
-  int nblock = x->size();
+  int nblock = x.size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      int neq = nodeID[node].size();
+      int neq = nodeID.dimension(2);
       std::size_t num_dof = neq * this->numNodes;
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1431,7 +1430,7 @@ evaluateFields(typename Traits::EvalData workset)
         valref.val().reset(nblock);
         valref.val().copyForWrite();
         for (int block=0; block<nblock; block++)
-          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID[node][this->offset + eq]];
+          valref.val().fastAccessCoeff(block) = x[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1444,7 +1443,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = xdot[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1458,7 +1457,7 @@ evaluateFields(typename Traits::EvalData workset)
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = xdotdot[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
@@ -1493,7 +1492,7 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP<const Stokhos::ProductEpetraVector > x =
     workset.mp_x;
   Teuchos::RCP<const Stokhos::ProductEpetraVector > xdot =
@@ -1510,9 +1509,8 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if(this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
   int nblock = x->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -1523,12 +1521,12 @@ evaluateFields(typename Traits::EvalData workset)
         if (Vx != Teuchos::null && workset.j_coeff != 0.0) {
           for (int k=0; k<workset.num_cols_x; k++)
             valref.fastAccessDx(k) =
-              workset.j_coeff*(*Vx)[k][nodeID[node][this->offset + eq]];
+              workset.j_coeff*(*Vx)[k][nodeID(cell,node,this->offset + eq)];
         }
         valref.val().reset(nblock);
         valref.val().copyForWrite();
         for (int block=0; block<nblock; block++)
-          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID[node][this->offset + eq]];
+          valref.val().fastAccessCoeff(block) = (*x)[block][nodeID(cell,node,this->offset + eq)];
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1540,12 +1538,12 @@ evaluateFields(typename Traits::EvalData workset)
           if (Vxdot != Teuchos::null && workset.m_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.m_coeff*(*Vxdot)[k][nodeID[node][this->offset + eq]];
+                workset.m_coeff*(*Vxdot)[k][nodeID(cell,node,this->offset + eq)];
           }
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -1558,16 +1556,20 @@ evaluateFields(typename Traits::EvalData workset)
           if (Vxdotdot != Teuchos::null && workset.n_coeff != 0.0) {
             for (int k=0; k<workset.num_cols_x; k++)
               valref.fastAccessDx(k) =
-                workset.n_coeff*(*Vxdotdot)[k][nodeID[node][this->offset + eq]];
+                workset.n_coeff*(*Vxdotdot)[k][nodeID(cell,node,this->offset + eq)];
           }
           valref.val().reset(nblock);
           valref.val().copyForWrite();
           for (int block=0; block<nblock; block++)
-            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID[node][this->offset + eq]];
+            valref.val().fastAccessCoeff(block) = (*xdotdot)[block][nodeID(cell,node,this->offset + eq)];
         }
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "GatherSolution<MPTangent>: ensemble tangents require the Epetra build.");
+#endif
 }
 #endif
 
@@ -18,6 +18,10 @@ namespace PHAL {
 
     This evaluator interpolates nodal DOF values to quad points.
 
+    With "Fused Interpolation", the temperature, its time derivative and
+    its gradient are interpolated from the gathered nodal values inside
+    the residual loop, one cell at a time, in place of the DOFInterpolation
+    and DOFGradInterpolation evaluators and their quad point fields.
 */
 
 template<typename EvalT, typename Traits>
@@ -35,6 +39,8 @@ public:
 
 private:
 
+  void evaluateFused(typename Traits::EvalData d);
+
   typedef typename EvalT::ScalarT ScalarT;
   typedef typename EvalT::MeshScalarT MeshScalarT;
 
@@ -50,6 +56,12 @@ private:
   PHX::MDField<ScalarT,Cell,QuadPoint> rhoCp;
   PHX::MDField<ScalarT,Cell,QuadPoint> Absorption;
 
+  // Input for the fused interpolation:
+  PHX::MDField<ScalarT,Cell,Node> TemperatureNode;
+  PHX::MDField<ScalarT,Cell,Node> TdotNode;
+  PHX::MDField<MeshScalarT,Cell,Node,QuadPoint> BF;
+  PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
+
   // Output:
   PHX::MDField<ScalarT,Cell,Node> TResidual;
 
@@ -58,6 +70,7 @@ private:
   bool haveAbsorption;
   bool enableTransient;
   bool haverhoCp;
+  bool fused;
   unsigned int numQPs, numDims, numNodes, worksetSize;
   Intrepid2::FieldContainer_Kokkos<ScalarT, PHX::Layout, PHX::Device> flux;
   Intrepid2::FieldContainer_Kokkos<ScalarT, PHX::Layout, PHX::Device> aterm;
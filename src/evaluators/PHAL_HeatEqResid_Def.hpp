@@ -34,7 +34,8 @@ HeatEqResid(const Teuchos::ParameterList& p) :
   haveSource  (p.get<bool>("Have Source")),
   haveConvection(false),
   haveAbsorption  (p.get<bool>("Have Absorption")),
-  haverhoCp(false)
+  haverhoCp(false),
+  fused(p.isType<bool>("Fused Interpolation") && p.get<bool>("Fused Interpolation"))
 {
 
   if (p.isType<bool>("Disable Transient"))
@@ -42,11 +43,34 @@ HeatEqResid(const Teuchos::ParameterList& p) :
   else enableTransient = true;
 
   this->addDependentField(wBF);
-  this->addDependentField(Temperature);
   this->addDependentField(ThermalCond);
-  if (enableTransient) this->addDependentField(Tdot);
-  this->addDependentField(TGrad);
   this->addDependentField(wGradBF);
+  if (fused) {
+    // The nodal values from the gather, under the same names
+    TemperatureNode = PHX::MDField<ScalarT,Cell,Node>(
+        p.get<std::string>("QP Variable Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node Scalar Data Layout"));
+    BF = PHX::MDField<MeshScalarT,Cell,Node,QuadPoint>(
+        p.get<std::string>("BF Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node QP Scalar Data Layout"));
+    GradBF = PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim>(
+        p.get<std::string>("Gradient BF Name"),
+        p.get<Teuchos::RCP<PHX::DataLayout> >("Node QP Vector Data Layout"));
+    this->addDependentField(TemperatureNode);
+    this->addDependentField(BF);
+    this->addDependentField(GradBF);
+    if (enableTransient) {
+      TdotNode = PHX::MDField<ScalarT,Cell,Node>(
+          p.get<std::string>("QP Time Derivative Variable Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout> >("Node Scalar Data Layout"));
+      this->addDependentField(TdotNode);
+    }
+  }
+  else {
+    this->addDependentField(Temperature);
+    if (enableTransient) this->addDependentField(Tdot);
+    this->addDependentField(TGrad);
+  }
   if (haveSource) this->addDependentField(Source);
   if (haveAbsorption) {
     Absorption = PHX::MDField<ScalarT,Cell,QuadPoint>(
@@ -65,6 +89,8 @@ HeatEqResid(const Teuchos::ParameterList& p) :
   numQPs  = dims[2];
   numDims = dims[3];
 
+  TEUCHOS_TEST_FOR_EXCEPTION(fused && numDims > 3, std::logic_error,
+    "Error! HeatEqResid: Fused Interpolation supports up to 3 dimensions." << std::endl);
 
   // Allocate workspace
   flux.resize(worksetSize, numQPs, numDims);
@@ -99,12 +125,20 @@ postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
   this->utils.setFieldData(wBF,fm);
-  this->utils.setFieldData(Temperature,fm);
   this->utils.setFieldData(ThermalCond,fm);
-  this->utils.setFieldData(TGrad,fm);
   this->utils.setFieldData(wGradBF,fm);
+  if (fused) {
+    this->utils.setFieldData(TemperatureNode,fm);
+    this->utils.setFieldData(BF,fm);
+    this->utils.setFieldData(GradBF,fm);
+    if (enableTransient) this->utils.setFieldData(TdotNode,fm);
+  }
+  else {
+    this->utils.setFieldData(Temperature,fm);
+    this->utils.setFieldData(TGrad,fm);
+    if (enableTransient) this->utils.setFieldData(Tdot,fm);
+  }
   if (haveSource)  this->utils.setFieldData(Source,fm);
-  if (enableTransient) this->utils.setFieldData(Tdot,fm);
 
   if (haveAbsorption)  this->utils.setFieldData(Absorption,fm);
 
@@ -121,6 +155,10 @@ evaluateFields(typename Traits::EvalData workset)
 
 //// workset.print(std::cout);
 
+  if (fused) {
+    evaluateFused(workset);
+    return;
+  }
 
   typedef Intrepid2::FunctionSpaceTools FST;
 
@@ -205,6 +243,66 @@ evaluateFields(typename Traits::EvalData workset)
 
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void HeatEqResid<EvalT, Traits>::
+evaluateFused(typename Traits::EvalData workset)
+{
+  // Quad point values live in these locals, one cell at a time
+  ScalarT T, dTdt, coeff;
+  ScalarT flux_qp[3];
+
+  const bool transient = workset.transientTerms && enableTransient;
+
+  for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+    for (std::size_t node=0; node < numNodes; ++node)
+      TResidual(cell,node) = 0.0;
+
+    for (std::size_t qp=0; qp < numQPs; ++qp) {
+      // flux_qp holds the temperature gradient until it is scaled below
+      for (std::size_t i=0; i < numDims; ++i) {
+        flux_qp[i] = TemperatureNode(cell,0) * GradBF(cell,0,qp,i);
+        for (std::size_t node=1; node < numNodes; ++node)
+          flux_qp[i] += TemperatureNode(cell,node) * GradBF(cell,node,qp,i);
+      }
+
+      // Everything tested against wBF
+      coeff = 0.0;
+      if (haveSource)
+        coeff -= Source(cell,qp);
+      if (transient) {
+        dTdt = TdotNode(cell,0) * BF(cell,0,qp);
+        for (std::size_t node=1; node < numNodes; ++node)
+          dTdt += TdotNode(cell,node) * BF(cell,node,qp);
+        coeff += dTdt;
+      }
+      if (haveConvection) {
+        for (std::size_t i=0; i < numDims; ++i) {
+          if (haverhoCp)
+            coeff += rhoCp(cell,qp) * convectionVels[i] * flux_qp[i];
+          else
+            coeff += convectionVels[i] * flux_qp[i];
+        }
+      }
+      if (haveAbsorption) {
+        T = TemperatureNode(cell,0) * BF(cell,0,qp);
+        for (std::size_t node=1; node < numNodes; ++node)
+          T += TemperatureNode(cell,node) * BF(cell,node,qp);
+        coeff += Absorption(cell,qp) * T;
+      }
+
+      for (std::size_t i=0; i < numDims; ++i)
+        flux_qp[i] *= ThermalCond(cell,qp);
+
+      for (std::size_t node=0; node < numNodes; ++node) {
+        TResidual(cell,node) += coeff * wBF(cell,node,qp);
+        for (std::size_t i=0; i < numDims; ++i)
+          TResidual(cell,node) += flux_qp[i] * wGradBF(cell,node,qp,i);
+      }
+    }
+  }
+}
+
 //**********************************************************************
 }
 
@@ -364,6 +364,8 @@ public:
   Neumann(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
 private:
+  //! Tpetra ensemble fill (workset.mp_JacT)
+  void evaluateFieldsT(typename Traits::EvalData d);
   typedef typename PHAL::AlbanyTraits::MPJacobian::ScalarT ScalarT;
 };
 
@@ -1906,23 +1906,39 @@ template<typename Traits>
 void Neumann<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
-
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateNeumannContribution(workset);
 
-  int nblock = f->size();
-  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
+#if defined(ALBANY_EPETRA)
+  if (Teuchos::is_null(workset.mp_fT)) {
+    Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
 
-    for (std::size_t node = 0; node < this->numNodes; ++node)
-      for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
+    int nblock = f->size();
+    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
 
-        for (int block=0; block<nblock; block++)
-          (*f)[block][nodeID[node][this->offset[dim]]] += this->neumann(cell, node, dim).coeff(block);
+      for (std::size_t node = 0; node < this->numNodes; ++node)
+        for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
 
+          for (int block=0; block<nblock; block++)
+            (*f)[block][nodeID[node][this->offset[dim]]] += this->neumann(cell, node, dim).coeff(block);
+
+      }
     }
+    return;
+  }
+#endif
+
+  // Tpetra ensemble fill: one residual column per sample
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT = workset.mp_fT->get2dViewNonConst();
+  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
+
+    for (std::size_t node = 0; node < this->numNodes; ++node)
+      for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim)
+        for (int block=0; block<fT.size(); block++)
+          fT[block][nodeID[node][this->offset[dim]]] += this->neumann(cell, node, dim).coeff(block);
   }
 }
 
@@ -1942,14 +1958,20 @@ template<typename Traits>
 void Neumann<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
-  Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > Jac =
-    workset.mp_Jac;
-
   // Fill the local "neumann" array with cell contributions
 
   this->evaluateNeumannContribution(workset);
 
+  if (workset.mp_JacT.size() > 0) {
+    evaluateFieldsT(workset);
+    return;
+  }
+
+#if defined(ALBANY_EPETRA)
+  Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
+  Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > Jac =
+    workset.mp_Jac;
+
   int row, lcol, col;
   int nblock = 0;
 
@@ -1998,6 +2020,50 @@ evaluateFields(typename Traits::EvalData workset)
         } // has fast access
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "Neumann<MPJacobian>: no ensemble Jacobian set in the workset.");
+#endif
+}
+
+// **********************************************************************
+template<typename Traits>
+void Neumann<PHAL::AlbanyTraits::MPJacobian, Traits>::
+evaluateFieldsT(typename Traits::EvalData workset)
+{
+  // Tpetra ensemble fill: one matrix and one residual column per sample
+  const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& JacT = workset.mp_JacT;
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > fT;
+  if (Teuchos::nonnull(workset.mp_fT))
+    fT = workset.mp_fT->get2dViewNonConst();
+
+  Teuchos::Array<LO> col(1);
+  Teuchos::Array<ST> c(1);
+
+  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
+
+    for (std::size_t node = 0; node < this->numNodes; ++node)
+      for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
+
+        const LO row = nodeID[node][this->offset[dim]];
+        const int neq = nodeID[node].size();
+
+        for (int block=0; block<fT.size(); block++)
+          fT[block][row] += this->neumann(cell, node, dim).val().coeff(block);
+
+        if (this->neumann(cell, node, dim).hasFastAccess()) {
+          for (unsigned int node_col=0; node_col<this->numNodes; node_col++)
+            for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
+              col[0] = nodeID[node_col][eq_col];
+              for (int block=0; block<JacT.size(); block++) {
+                c[0] = this->neumann(cell, node, dim).fastAccessDx(neq*node_col + eq_col).coeff(block);
+                JacT[block]->sumIntoLocalValues(row, col(), c());
+              }
+            }
+        }
+    }
+  }
 }
 
 // **********************************************************************
@@ -2016,6 +2082,7 @@ template<typename Traits>
 void Neumann<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > JV = workset.mp_JV;
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > fp = workset.mp_fp;
@@ -2060,6 +2127,10 @@ evaluateFields(typename Traits::EvalData workset)
 
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "Neumann<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
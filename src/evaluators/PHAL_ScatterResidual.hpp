@@ -162,6 +162,9 @@ protected:
   const std::size_t numFields;
 private:
   typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  //! Sum neq x neq node blocks into workset.JacBlockT (Block CRS storage)
+  void evaluateBlockFields(typename Traits::EvalData d);
   //typedef Kokkos::View < ScalarT***, Kokkos::LayoutRight, PHX::Device > temp_view_type;
 
 //Kokkos
@@ -8,6 +8,7 @@
 #endif
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "Albany_JacobianAssemblyPlan.hpp"
 
 // **********************************************************************
 // Base Class Generic Implemtation
@@ -157,29 +158,29 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::ArrayRCP<ST> f_nonconstView = fT->get1dViewNonConst();
 
   if (this->tensorRank == 0) {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t eq = 0; eq < numFields; eq++)
-          f_nonconstView[nodeID[node][this->offset + eq]] += (this->val[eq])(cell,node);
+          f_nonconstView[nodeID(cell,node,this->offset + eq)] += (this->val[eq])(cell,node);
     }
   } else 
   if (this->tensorRank == 1) {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t eq = 0; eq < numFields; eq++)
-          f_nonconstView[nodeID[node][this->offset + eq]] += (this->valVec)(cell,node,eq);
+          f_nonconstView[nodeID(cell,node,this->offset + eq)] += (this->valVec)(cell,node,eq);
     }
   } else
   if (this->tensorRank == 2) {
     int numDims = this->valTensor[0].dimension(2);
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t i = 0; i < numDims; i++)
           for (std::size_t j = 0; j < numDims; j++)
-            f_nonconstView[nodeID[node][this->offset + i*numDims + j]] += (this->valTensor[0])(cell,node,i,j);
+            f_nonconstView[nodeID(cell,node,this->offset + i*numDims + j)] += (this->valTensor[0])(cell,node,i,j);
   
     }
   }
@@ -464,23 +465,52 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  if (Teuchos::nonnull(workset.JacBlockT)) {
+    evaluateBlockFields(workset);
+    return;
+  }
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   Teuchos::RCP<Tpetra_Vector> fT = workset.fT;
   Teuchos::RCP<Tpetra_CrsMatrix> JacT = workset.JacT;
   const bool loadResid = Teuchos::nonnull(fT);
   Teuchos::Array<LO> colT;
-  const int neq = workset.wsElNodeEqID[0][0].size();
+  const int neq = workset.wsElNodeEqID_kokkos.dimension(2);
   const int nunk = neq*this->numNodes;
   colT.resize(nunk);
   int numDim = 0;
   if (this->tensorRank==2) numDim = this->valTensor[0].dimension(2);
 
+  // Add straight into the local values through the cached offsets
+  if (Teuchos::nonnull(workset.jacAssemblyPlan) && !workset.is_adjoint) {
+    ST* jacVals = JacT->getLocalMatrix().values.ptr_on_device();
+    const LO* wsOffsets = workset.jacAssemblyPlan->getOffsets(workset.wsIndex).getRawPtr();
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
+    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      for (std::size_t node = 0; node < this->numNodes; ++node) {
+        for (std::size_t eq = 0; eq < numFields; eq++) {
+          typename PHAL::Ref<ScalarT>::type
+            valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
+                      this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+                      this->valTensor[0](cell,node, eq/numDim, eq%numDim));
+          if (loadResid)
+            fT->sumIntoLocalValue(nodeID(cell,node,this->offset + eq), valptr.val());
+          if (valptr.hasFastAccess()) {
+            const LO* offsets = wsOffsets + ((cell*this->numNodes + node)*neq + this->offset + eq)*nunk;
+            for (unsigned int lunk = 0; lunk < nunk; lunk++)
+              jacVals[offsets[lunk]] += valptr.fastAccessDx(lunk);
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID = workset.wsElNodeEqID[cell];
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
       for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
-        colT[neq * node_col + eq_col] = nodeID[node_col][eq_col];
+        colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
       }
     }
     for (std::size_t node = 0; node < this->numNodes; ++node) {
@@ -489,7 +519,7 @@ evaluateFields(typename Traits::EvalData workset)
           valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
-        const LO rowT = nodeID[node][this->offset + eq];
+        const LO rowT = nodeID(cell,node,this->offset + eq);
         if (loadResid)
           fT->sumIntoLocalValue(rowT, valptr.val());
         // Check derivative array is nonzero
@@ -523,7 +553,7 @@ evaluateFields(typename Traits::EvalData workset)
 
    loadResid = Teuchos::nonnull(fT);
 
-   neq = workset.wsElNodeEqID[0][0].size();
+   neq = workset.wsElNodeEqID_kokkos.dimension(2);
    nunk = neq*this->numNodes;
 
    numDim=0;
@@ -560,6 +590,67 @@ evaluateFields(typename Traits::EvalData workset)
 
 }
 
+// **********************************************************************
+template<typename Traits>
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
+evaluateBlockFields(typename Traits::EvalData workset)
+{
+  // With interleaved ordering the overlapped DOF LID of (node, eq) is
+  // node*neq + eq, so block rows and columns are overlap node LIDs.
+  Teuchos::RCP<Tpetra_Vector> fT = workset.fT;
+  Teuchos::RCP<Tpetra_BlockCrsMatrix> JacBlockT = workset.JacBlockT;
+  const bool loadResid = Teuchos::nonnull(fT);
+  const int neq = workset.wsElNodeEqID_kokkos.dimension(2);
+  const int bs2 = neq*neq;
+  TEUCHOS_TEST_FOR_EXCEPTION(JacBlockT->getBlockSize() != neq, std::logic_error,
+    "ScatterResidual: block size " << JacBlockT->getBlockSize()
+    << " does not match the number of equations " << neq << std::endl);
+
+  Teuchos::Array<LO> colBlk(this->numNodes);
+  Teuchos::Array<ST> blocks(this->numNodes*bs2);
+  int numDim = 0;
+  if (this->tensorRank==2) numDim = this->valTensor[0].dimension(2);
+
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
+  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    for (unsigned int node_col=0; node_col<this->numNodes; node_col++)
+      colBlk[node_col] = nodeID(cell,node_col,0) / neq;
+
+    for (std::size_t node = 0; node < this->numNodes; ++node) {
+      const LO rowBlk = nodeID(cell,node,0) / neq;
+      bool hasDx = false;
+      std::fill(blocks.begin(), blocks.end(), 0.0);
+      for (std::size_t eq = 0; eq < numFields; eq++) {
+        typename PHAL::Ref<ScalarT>::type
+          valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
+                    this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+                    this->valTensor[0](cell,node, eq/numDim, eq%numDim));
+        const int row = this->offset + eq;
+        if (loadResid)
+          fT->sumIntoLocalValue(nodeID(cell,node,row), valptr.val());
+        if (valptr.hasFastAccess()) {
+          hasDx = true;
+          // Blocks are stored row-major; the transposed block for the adjoint
+          for (unsigned int node_col=0; node_col<this->numNodes; node_col++)
+            for (int eq_col=0; eq_col<neq; eq_col++) {
+              const int blk = workset.is_adjoint ? eq_col*neq + row : row*neq + eq_col;
+              blocks[node_col*bs2 + blk] = valptr.fastAccessDx(neq*node_col + eq_col);
+            }
+        }
+      }
+      if (!hasDx) continue;
+
+      if (workset.is_adjoint) {
+        for (unsigned int node_col=0; node_col<this->numNodes; node_col++)
+          JacBlockT->sumIntoLocalValues(colBlk[node_col], &rowBlk, &blocks[node_col*bs2], 1);
+      }
+      else {
+        JacBlockT->sumIntoLocalValues(rowBlk, colBlk.getRawPtr(), blocks.getRawPtr(), this->numNodes);
+      }
+    }
+  }
+}
+
 // **********************************************************************
 // Specialization: Tangent
 // **********************************************************************
@@ -585,10 +676,8 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if (this->tensorRank == 2) numDim = this->valTensor[0].dimension(2);
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell = 0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<LO> >&
-      nodeID = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type valref = (
@@ -596,7 +685,7 @@ evaluateFields(typename Traits::EvalData workset)
             this->tensorRank == 1 ? this->valVec (cell, node, eq) :
             this->valTensor[0] (cell, node, eq / numDim, eq % numDim));
 
-        const LO row = nodeID[node][this->offset + eq];
+        const LO row = nodeID(cell,node,this->offset + eq);
 
         if (Teuchos::nonnull (fT))
           fT->sumIntoLocalValue (row, valref.val ());
@@ -663,9 +752,8 @@ evaluateFields(typename Traits::EvalData workset)
     }
   }
   else {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID =
-        workset.wsElNodeEqID[cell];
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size();
@@ -676,7 +764,7 @@ evaluateFields(typename Traits::EvalData workset)
                     valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                               this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                               this->valTensor[0](cell,node, eq/numDim, eq%numDim));
-          const int row = nodeID[node][this->offset + eq];
+          const int row = nodeID(cell,node,this->offset + eq);
           for (int col=0; col<num_cols; col++) {
             double val = 0.0;
             for (int i=0; i<num_deriv; ++i)
@@ -745,9 +833,8 @@ evaluateFields(typename Traits::EvalData workset)
     }
   }
   else {
+    const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID =
-        workset.wsElNodeEqID[cell];
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size();
@@ -758,7 +845,7 @@ evaluateFields(typename Traits::EvalData workset)
                     valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                               this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                               this->valTensor[0](cell,node, eq/numDim, eq%numDim));
-          const int row = nodeID[node][this->offset + eq];
+          const int row = nodeID(cell,node,this->offset + eq);
           for (int col=0; col<num_cols; col++) {
             double val = 0.0;
             for (int i=0; i<num_deriv; ++i)
@@ -797,9 +884,8 @@ evaluateFields(typename Traits::EvalData workset)
     numDim = this->valTensor[0].dimension(2);
 
   int nblock = f->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -809,7 +895,7 @@ evaluateFields(typename Traits::EvalData workset)
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
 
         for (int block=0; block<nblock; block++)
-          (*f)[block][nodeID[node][this->offset + eq]] += valptr.coeff(block);
+          (*f)[block][nodeID(cell,node,this->offset + eq)] += valptr.coeff(block);
       }
     }
   }
@@ -848,9 +934,8 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -859,8 +944,8 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
 
-        row = nodeID[node][this->offset + eq];
-        int neq = nodeID[node].size();
+        row = nodeID(cell,node,this->offset + eq);
+        int neq = nodeID.dimension(2);
 
         if (f != Teuchos::null) {
           for (int block=0; block<nblock; block++)
@@ -878,7 +963,7 @@ evaluateFields(typename Traits::EvalData workset)
               lcol = neq * node_col + eq_col;
 
               // Global column
-              col =  nodeID[node_col][eq_col];
+              col =  nodeID(cell,node_col,eq_col);
 
               // Sum Jacobian
               for (int block=0; block<nblock_jac; block++) {
@@ -936,9 +1021,8 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -946,7 +1030,7 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
 
-        int row = nodeID[node][this->offset + eq];
+        int row = nodeID(cell,node,this->offset + eq);
 
         if (f != Teuchos::null)
           for (int block=0; block<nblock; block++)
@@ -968,6 +1052,31 @@ evaluateFields(typename Traits::EvalData workset)
 #endif 
 #ifdef ALBANY_ENSEMBLE 
 
+// **********************************************************************
+// Local values of each sample of the ensemble residual: the Tpetra ensemble
+// fill sets the multivector, the Epetra one the product vector.
+inline int
+getEnsembleViewsNonConst(const PHAL::Workset& workset,
+                         Teuchos::Array<Teuchos::ArrayRCP<ST> >& views)
+{
+  views.clear();
+  if (Teuchos::nonnull(workset.mp_fT)) {
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST> > cols =
+      workset.mp_fT->get2dViewNonConst();
+    views.assign(cols.begin(), cols.end());
+  }
+#if defined(ALBANY_EPETRA)
+  else if (Teuchos::nonnull(workset.mp_f)) {
+    Stokhos::ProductEpetraVector& f = *workset.mp_f;
+    views.resize(f.size());
+    for (int block=0; block<f.size(); block++)
+      views[block] = Teuchos::arcp<ST>(f[block].Values(), 0,
+                                       f[block].MyLength(), false);
+  }
+#endif
+  return views.size();
+}
+
 // **********************************************************************
 // Specialization: Multi-point Residual
 // **********************************************************************
@@ -986,16 +1095,15 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::MPResidual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
+  Teuchos::Array<Teuchos::ArrayRCP<ST> > f;
+  int nblock = getEnsembleViewsNonConst(workset, f);
 
   int numDim=0;
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
-  int nblock = f->size();
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1004,7 +1112,7 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
         for (int block=0; block<nblock; block++)
-          (*f)[block][nodeID[node][this->offset + eq]] += valptr.coeff(block);
+          f[block][nodeID(cell,node,this->offset + eq)] += valptr.coeff(block);
       }
     }
   }
@@ -1028,27 +1136,32 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
+  Teuchos::Array<Teuchos::ArrayRCP<ST> > f;
+  int nblock = getEnsembleViewsNonConst(workset, f);
+
+  // The Tpetra ensemble fill sets mp_JacT, the Epetra one mp_Jac
+  const Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix> >& JacT = workset.mp_JacT;
+  const bool useTpetra = (JacT.size() > 0);
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP< Stokhos::ProductContainer<Epetra_CrsMatrix> > Jac =
     workset.mp_Jac;
+  int nblock_jac = useTpetra ? JacT.size() : Jac->size();
+#else
+  int nblock_jac = JacT.size();
+#endif
 
   int row, lcol;
-  int nblock = 0;
-  if (f != Teuchos::null)
-    nblock = f->size();
-  int nblock_jac = Jac->size();
-  const int neq = workset.wsElNodeEqID[0][0].size();
+  const int neq = workset.wsElNodeEqID_kokkos.dimension(2);
   const int nunk = neq*this->numNodes;
   Teuchos::Array<double> val(nunk); // use double since it goes into CrsMatrix
-  Teuchos::Array<int> col(nunk);
+  Teuchos::Array<LO> col(nunk);
 
   int numDim=0;
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
 
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -1057,12 +1170,10 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
 
-        row = nodeID[node][this->offset + eq];
+        row = nodeID(cell,node,this->offset + eq);
 
-        if (f != Teuchos::null) {
-          for (int block=0; block<nblock; block++)
-            (*f)[block].SumIntoMyValue(row, 0, valptr.val().coeff(block));
-        }
+        for (int block=0; block<nblock; block++)
+          f[block][row] += valptr.val().coeff(block);
 
         // Check derivative array is nonzero
         if (valptr.hasFastAccess()) {
@@ -1080,7 +1191,7 @@ evaluateFields(typename Traits::EvalData workset)
                 lcol = neq * node_col + eq_col;
 
                 // Global column
-                col[lcol] =  nodeID[node_col][eq_col];
+                col[lcol] =  nodeID(cell,node_col,eq_col);
 
                 // Matrix value
                 val[lcol] = valptr.fastAccessDx(lcol).coeff(block);
@@ -1090,8 +1201,13 @@ evaluateFields(typename Traits::EvalData workset)
             } // column nodes
 
             // Sum Jacobian
-            (*Jac)[block].SumIntoMyValues(row, nunk,
-                                          val.getRawPtr(), col.getRawPtr());
+            if (useTpetra)
+              JacT[block]->sumIntoLocalValues(row, col(), val());
+#if defined(ALBANY_EPETRA)
+            else
+              (*Jac)[block].SumIntoMyValues(row, nunk,
+                                            val.getRawPtr(), col.getRawPtr());
+#endif
 
           } // has fast access
 
@@ -1122,6 +1238,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::MPTangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   Teuchos::RCP< Stokhos::ProductEpetraVector > f = workset.mp_f;
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > JV = workset.mp_JV;
   Teuchos::RCP< Stokhos::ProductEpetraMultiVector > fp = workset.mp_fp;
@@ -1142,9 +1259,8 @@ evaluateFields(typename Traits::EvalData workset)
   if(this->tensorRank==2)
     numDim = this->valTensor[0].dimension(2);
 
+  const Albany::WsElNodeEqIDView& nodeID = workset.wsElNodeEqID_kokkos;
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<int> >& nodeID  = workset.wsElNodeEqID[cell];
-
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
@@ -1152,7 +1268,7 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor[0](cell,node, eq/numDim, eq%numDim));
 
-        int row = nodeID[node][this->offset + eq];
+        int row = nodeID(cell,node,this->offset + eq);
 
         if (f != Teuchos::null)
           for (int block=0; block<nblock; block++)
@@ -1170,6 +1286,10 @@ evaluateFields(typename Traits::EvalData workset)
       }
     }
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "ScatterResidual<MPTangent>: ensemble tangents require the Epetra build.");
+#endif
 }
 #endif
 
@@ -225,6 +225,7 @@ template<typename Traits>
 void ScatterScalarResponse<PHAL::AlbanyTraits::MPResidual, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Here we scatter the *global* MP response
   Teuchos::RCP<Stokhos::ProductEpetraVector> g_mp = workset.mp_g;
   for (std::size_t res = 0; res < this->global_response.size(); res++) {
@@ -233,6 +234,10 @@ postEvaluate(typename Traits::PostEvalData workset)
     for (int block=0; block<g_mp->size(); block++)
       (*g_mp)[block][res] = (this->global_response[res]).coeff(block);
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "ScatterScalarResponse<MPResidual>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 // **********************************************************************
@@ -251,6 +256,7 @@ template<typename Traits>
 void ScatterScalarResponse<PHAL::AlbanyTraits::MPTangent, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Here we scatter the *global* MP response and tangent
   Teuchos::RCP<Stokhos::ProductEpetraVector> g_mp = workset.mp_g;
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> gx_mp = workset.mp_dgdx;
@@ -271,6 +277,10 @@ postEvaluate(typename Traits::PostEvalData workset)
 	  (*gp_mp)[block].ReplaceMyValue(
 	    res, col, (this->global_response[res]).dx(col+workset.param_offset).coeff(block));
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "ScatterScalarResponse<MPTangent>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
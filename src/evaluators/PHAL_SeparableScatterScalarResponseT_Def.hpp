@@ -391,6 +391,7 @@ template<typename Traits>
 void SeparableScatterScalarResponseT<PHAL::AlbanyTraits::MPJacobian, Traits>::
 preEvaluate(typename Traits::PreEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Initialize derivatives
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> dgdx_mp =
     workset.mp_dgdx;
@@ -409,12 +410,17 @@ preEvaluate(typename Traits::PreEvalData workset)
     dgdxdot_mp->init(0.0);
     overlapped_dgdxdot_mp->init(0.0);
   }
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SeparableScatterScalarResponseT<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 template<typename Traits>
 void SeparableScatterScalarResponseT<PHAL::AlbanyTraits::MPJacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Here we scatter the *local* MP response derivative
   Teuchos::RCP<Stokhos::ProductEpetraMultiVector> dgdx_mp =
     workset.overlapped_mp_dgdx;
@@ -457,12 +463,17 @@ evaluateFields(typename Traits::EvalData workset)
       } // response
     } // node
   } // cell
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SeparableScatterScalarResponseT<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 
 template<typename Traits>
 void SeparableScatterScalarResponseT<PHAL::AlbanyTraits::MPJacobian, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Here we scatter the *global* MP response
   Teuchos::RCP<Stokhos::ProductEpetraVector> g_mp = workset.mp_g;
   if (g_mp != Teuchos::null) {
@@ -491,6 +502,10 @@ postEvaluate(typename Traits::PostEvalData workset)
     for (int block=0; block<dgdxdot_mp->size(); block++)
       (*dgdxdot_mp)[block].Export((*overlapped_dgdxdot_mp)[block],
 				  *workset.x_importer, Add);
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "SeparableScatterScalarResponseT<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -234,6 +234,7 @@ void
 QCAD::FieldValueScatterScalarResponse<PHAL::AlbanyTraits::MPJacobian, Traits>::
 postEvaluate(typename Traits::PostEvalData workset)
 {
+#if defined(ALBANY_EPETRA)
   // Here we scatter the *global* MP response
   Teuchos::RCP<Stokhos::ProductEpetraVector> g_mp = workset.mp_g;
   if (g_mp != Teuchos::null) {
@@ -299,6 +300,10 @@ postEvaluate(typename Traits::PostEvalData workset)
   for (int block=0; block<dgdx_mp->size(); block++)
     (*dg_mp)[block].Export((*overlapped_dg_mp)[block],
                            *workset.x_importer, Add);
+#else
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+    "FieldValueScatterScalarResponse<MPJacobian>: ensemble evaluation requires the Epetra build.");
+#endif
 }
 #endif
 
@@ -150,6 +150,18 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
+  validPL->set<bool>("Parallel Workset Fill", false,
+                     "Fill the residual and Jacobian with several threads, one workset per thread at a time");
+  validPL->set<int>("Parallel Workset Fill Threads", 1,
+                     "Number of fill threads used when Parallel Workset Fill is enabled");
+  validPL->set<bool>("Measure Fill Cost", false,
+                     "Time the residual fill of each workset; Adaptation can balance with it");
+  validPL->set<bool>("Fused Responses", false,
+                     "Evaluate the field-manager responses within the residual fill instead of in their own passes");
+  validPL->set<bool>("Matrix-Free Jacobian", false,
+                     "Apply the Jacobian through Tangent evaluations instead of assembling it");
+  validPL->set<std::string>("Matrix-Free Preconditioner", "None",
+                     "Preconditioner assembled for the matrix-free Jacobian: None or Block Jacobi");
 
   validPL->sublist("Model Order Reduction", false, "Specify the options relative to model order reduction");
 
@@ -95,6 +95,7 @@ Albany::AdvDiffProblem::getValidProblemParameters() const
 
   validPL->set("Number of PDE Equations", 1, "Number of PDE Equations in AdvDiff equation set");
   validPL->sublist("Options", false, "");
+  validPL->set<bool>("Fused Residual", false, "Interpolate U inside the residual evaluator, in one pass over each cell");
 
   return validPL;
 }
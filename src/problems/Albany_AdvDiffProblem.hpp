@@ -218,6 +218,13 @@ Albany::AdvDiffProblem::constructEvaluators(
     p->set< RCP<DataLayout> >("Node QP Scalar Data Layout", dl->node_qp_scalar);
     p->set< RCP<DataLayout> >("Node QP Gradient Data Layout", dl->node_qp_gradient);
 
+    // Interpolate U in the residual loop instead of through the QP fields
+    if (params->get<bool>("Fused Residual", false)) {
+      p->set<bool>("Fused Interpolation", true);
+      p->set<string>("BF Name", "BF");
+      p->set<string>("Gradient BF Name", "Grad BF");
+    }
+
     p->set<RCP<ParamLib> >("Parameter Library", paramLib);
     Teuchos::ParameterList& paramList = params->sublist("Options");
     p->set<Teuchos::ParameterList*>("Parameter List", &paramList);
@@ -170,6 +170,7 @@ Albany::HeatProblem::getValidProblemParameters() const
   validPL->sublist("Thermal Conductivity", false, "");
   validPL->set("Convection Velocity", "{0,0,0}", "");
   validPL->set<bool>("Have Rho Cp", false, "Flag to indicate if rhoCp is used");
+  validPL->set<bool>("Fused Residual", false, "Interpolate the temperature inside the residual evaluator, in one pass over each cell");
   validPL->set<std::string>("MaterialDB Filename","materials.xml","Filename of material database xml file");
 
   return validPL;
@@ -317,6 +317,16 @@ Albany::HeatProblem::constructEvaluators(
 
     p->set<string>("Weighted Gradient BF Name", "wGrad BF");
     p->set< RCP<DataLayout> >("Node QP Vector Data Layout", dl->node_qp_vector);
+
+    // Interpolate Temperature in the residual loop instead of through
+    // the QP fields; the interpolation evaluators above then only run
+    // for the source and the responses that need them
+    if (params->get<bool>("Fused Residual", false)) {
+      p->set<bool>("Fused Interpolation", true);
+      p->set<string>("BF Name", "BF");
+      p->set<string>("Gradient BF Name", "Grad BF");
+    }
+
     if (params->isType<string>("Convection Velocity"))
         p->set<string>("Convection Velocity",
                        params->get<string>("Convection Velocity"));
@@ -76,7 +76,20 @@ Albany::ResponseUtilities<EvalT,Traits>::constructResponses(
   p->set<RCP<ParameterList> >("Parameters From Problem", paramsFromProblem);
   Teuchos::RCP<const PHX::FieldTag> response_tag;
 
-  if (responseName == "Field Integral")
+  if (responseName == "Fused Responses")
+  {
+    // Several responses in one field manager, one sublist each (see
+    // Albany::Application::setupFusedResponses). Returns the first tag.
+    const int numResponses = responseParams.get<int>("Number of Responses");
+    for (int i=0; i<numResponses; i++) {
+      Teuchos::RCP<const PHX::FieldTag> tag =
+        constructResponses(fm, responseParams.sublist(Albany::strint("Response",i)),
+                           paramsFromProblem, stateMgr, meshSpecs);
+      if (i == 0) response_tag = tag;
+    }
+  }
+
+  else if (responseName == "Field Integral")
   {
     RCP<QCAD::ResponseFieldIntegral<EvalT,Traits> > res_ev =
       rcp(new QCAD::ResponseFieldIntegral<EvalT,Traits>(*p, dl));
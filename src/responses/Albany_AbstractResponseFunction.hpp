@@ -219,7 +219,7 @@ namespace Albany {
     //! \name Multi-point evaluation functions
     //@{
 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
     //! Evaluate multi-point response functions
     virtual void evaluateMPResponse(
       const double curr_time,
@@ -111,7 +111,7 @@ evaluateSGDerivative(
     sg_dg_dxdotdot.getLinearOp().get(), sg_dg_dp.getMultiVector().get());
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::DistributedResponseFunction::
@@ -85,7 +85,7 @@ namespace Albany {
       Stokhos::EpetraOperatorOrthogPoly* sg_dg_dxdotdot,
       Stokhos::EpetraMultiVectorOrthogPoly* sg_dg_dp) = 0;
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
     //! Evaluate multi-point derivative
     virtual void evaluateMPGradient(
@@ -161,7 +161,7 @@ namespace Albany {
       const EpetraExt::ModelEvaluator::SGDerivative& sg_dg_dxdotdot,
       const EpetraExt::ModelEvaluator::SGDerivative& sg_dg_dp);
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
     //! Evaluate multi-point derivative
     virtual void evaluateMPDerivative(
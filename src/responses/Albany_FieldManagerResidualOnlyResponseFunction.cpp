@@ -148,7 +148,7 @@ evaluateSGGradient(
   Stokhos::EpetraMultiVectorOrthogPoly* sg_dg_dp) {}
 #endif
 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 void Albany::FieldManagerResidualOnlyResponseFunction::
 evaluateMPResponse(
   const double curr_time,
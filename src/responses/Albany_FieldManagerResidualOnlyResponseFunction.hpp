@@ -36,6 +36,9 @@ namespace Albany {
       const Teuchos::RCP<Albany::StateManager>& stateMgr,
       Teuchos::ParameterList& responseParams);
 
+    //! These evaluators act on the mesh, so run them only when asked
+    virtual bool isFusable() const { return false; }
+
     virtual void 
     evaluateTangentT(const double alpha, 
 		    const double beta,
@@ -149,7 +152,7 @@ namespace Albany {
       Stokhos::EpetraMultiVectorOrthogPoly* sg_dg_dp);
 #endif
 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
     virtual void evaluateMPResponse(
       const double curr_time,
       const Stokhos::ProductEpetraVector* mp_xdot,
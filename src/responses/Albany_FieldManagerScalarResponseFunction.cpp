@@ -69,6 +69,7 @@ setup(Teuchos::ParameterList& responseParams)
     reb = reb_parm_present && responseParams.get<bool>(reb_parm, false);
   element_block_index = reb ? meshSpecs->ebNameToIndex[meshSpecs->ebName] : -1;
   if (reb_parm_present) responseParams.remove(reb_parm, false);
+  fusedParams = responseParams;
 
   // Create field manager
   rfm = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
@@ -78,6 +79,7 @@ setup(Teuchos::ParameterList& responseParams)
     problem->buildEvaluators(*rfm, *meshSpecs, *stateMgr, 
                              BUILD_RESPONSE_FM,
                              Teuchos::rcp(&responseParams,false));
+  response_tag = tags[0];
   int rank = tags[0]->dataLayout().rank();
   num_responses = tags[0]->dataLayout().dimension(rank-1);
   if (num_responses == 0)
@@ -652,7 +654,7 @@ evaluateSGGradient(
   }  
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::FieldManagerScalarResponseFunction::
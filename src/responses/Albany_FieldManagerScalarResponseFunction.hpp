@@ -41,6 +41,24 @@ namespace Albany {
     //! Perform post registration setup
     void postRegSetup();
 
+    //! Whether the residual fill may evaluate this response ("Fused Responses")
+    virtual bool isFusable() const { return true; }
+
+    //! Parameters the response evaluators were built from
+    const Teuchos::ParameterList& getResponseParams() const
+    { return fusedParams; }
+
+    //! Mesh specs the response field manager was built for
+    const Teuchos::RCP<Albany::MeshSpecsStruct>& getMeshSpecs() const
+    { return meshSpecs; }
+
+    //! Whether only the worksets of the mesh specs' element block contribute
+    bool isRestrictedToElementBlock() const { return element_block_index >= 0; }
+
+    //! Tag of the global response field for EvalT = Residual
+    const Teuchos::RCP<const PHX::FieldTag>& getResponseTag() const
+    { return response_tag; }
+
     //! Evaluate responses
     virtual void 
     evaluateResponseT(const double current_time,
@@ -178,7 +196,7 @@ namespace Albany {
     //! \name Multi-point evaluation functions
     //@{
 
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
     //! Evaluate multi-point response functions
     virtual void evaluateMPResponse(
       const double curr_time,
@@ -292,6 +310,10 @@ namespace Albany {
     //! sfm in Albany::Application.
     int element_block_index;
 
+    //! Copy of the response parameters, for building a fused field manager
+    Teuchos::ParameterList fusedParams;
+    Teuchos::RCP<const PHX::FieldTag> response_tag;
+
     bool performedPostRegSetup;
   };
 
@@ -261,7 +261,7 @@ evaluateSGDerivative(
            *sg_g);
 }
 #endif
-#ifdef ALBANY_ENSEMBLE
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::KLResponseFunction::
@@ -360,7 +360,7 @@ evaluateSGGradient(
   }
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::SamplingBasedScalarResponseFunction::
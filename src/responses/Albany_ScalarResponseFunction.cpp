@@ -155,7 +155,7 @@ evaluateSGDerivative(
     sg_dg_dp.getMultiVector().get());
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::ScalarResponseFunction::
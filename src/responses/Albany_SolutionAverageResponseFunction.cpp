@@ -276,7 +276,7 @@ evaluateSGGradient(
     sg_dg_dp->init(0.0);
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::SolutionAverageResponseFunction::
@@ -419,7 +419,7 @@ evaluateSGGradient(const double current_time,
     sg_dg_dp->init(0.0);
 }
 #endif 
-#ifdef ALBANY_ENSEMBLE 
+#if defined(ALBANY_ENSEMBLE) && defined(ALBANY_EPETRA)
 
 void
 Albany::SolutionResponseFunction::
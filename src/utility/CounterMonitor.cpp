@@ -21,4 +21,8 @@ string CounterMonitor::getStringValue (const monitored_type& val) {
   return std::to_string(static_cast<long long>(val.value()));
 }
 
+double CounterMonitor::getNumericValue (const monitored_type& val) {
+  return static_cast<double>(val.value());
+}
+
 }
@@ -29,6 +29,8 @@ namespace util {
     
   protected:
     virtual string        getStringValue(const monitored_type& val) override;
+    virtual bool          hasNumericValue() const override { return true; }
+    virtual double        getNumericValue(const monitored_type& val) override;
     
   };
 }
@@ -16,11 +16,13 @@
  */
 
 #include <Teuchos_Comm.hpp>
+#include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_PtrDecl.hpp>
 #include <Teuchos_RCPDecl.hpp>
 #include <Teuchos_DefaultComm.hpp>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -39,6 +41,12 @@ public:
   typedef string key_type;
   typedef std::map<key_type, Teuchos::RCP<monitored_type> > monitor_map;
 
+  //! Spread of one item over the ranks of a communicator
+  struct RankStats {
+    double min, avg, max;
+  };
+  typedef std::map<key_type, RankStats> stats_map;
+
   MonitorBase ();
   virtual ~MonitorBase () {
   }
@@ -50,15 +58,29 @@ public:
 
   void summarize (std::ostream &out = std::cout);
 
+  //! Min/avg/max of every item of rank 0 over all ranks (collective).
+  /*!
+   * Empty if the monitored type has no numeric value. Items that a rank
+   * never created count as zero on that rank.
+   */
+  stats_map reduceOverRanks (Teuchos::Ptr<const Teuchos::Comm<int> > comm);
+
 protected:
   
   virtual string getStringValue (const monitored_type& val) = 0;
 
+  //! Numeric value used for the per-rank statistics.
+  virtual bool hasNumericValue () const { return false; }
+  virtual double getNumericValue (const monitored_type& val) { return 0.0; }
+
   string title_;
   string itemTypeLabel_;
   string itemValueLabel_;
 
   monitor_map itemMap_;
+
+  //! Items may be looked up from the threads of a parallel workset fill
+  std::mutex itemMapMutex_;
 };
 
 template<class MonitoredType>
@@ -70,6 +92,7 @@ inline MonitorBase<MonitoredType>::MonitorBase ()
 template<class MonitoredType>
 inline typename MonitorBase<MonitoredType>::pointer_type MonitorBase<
     MonitoredType>::operator[] (const key_type &item) {
+  std::lock_guard<std::mutex> lock(itemMapMutex_);
   auto pos = itemMap_.find(item);
   if (pos == itemMap_.end())
     pos = itemMap_.insert(
@@ -85,15 +108,29 @@ inline void MonitorBase<MonitoredType>::summarize (
   
   //const int nprocs = comm->getSize();
   const int rank = comm->getRank();
+
+  // Collective, so every rank takes part before rank 0 prints
+  const stats_map stats = reduceOverRanks(comm);
   
   // Build table and print out data if we are rank 0
   if (0 == rank) {
     DisplayTable table;
-    table.addRow(itemTypeLabel_, itemValueLabel_);
+    if (stats.empty())
+      table.addRow(itemTypeLabel_, itemValueLabel_);
+    else
+      table.addRow(itemTypeLabel_, itemValueLabel_, "Min", "Avg", "Max");
     
     // Add each item from the map. Map will keep them sorted lexicographically
-    for (auto iter : itemMap_)
-      table.addRow(iter.first, getStringValue(*iter.second));
+    for (auto iter : itemMap_) {
+      auto pos = stats.find(iter.first);
+      if (pos == stats.end())
+        table.addRow(iter.first, getStringValue(*iter.second));
+      else
+        table.addRow(iter.first, getStringValue(*iter.second),
+                     std::to_string(pos->second.min),
+                     std::to_string(pos->second.avg),
+                     std::to_string(pos->second.max));
+    }
     
     //out << "Summary for " << title_ << std::endl;
     
@@ -106,6 +143,51 @@ inline void MonitorBase<MonitoredType>::summarize (
   }
 }
 
+template<class MonitoredType>
+inline typename MonitorBase<MonitoredType>::stats_map
+MonitorBase<MonitoredType>::reduceOverRanks (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm) {
+  stats_map stats;
+  if (!hasNumericValue()) return stats;
+
+  // Rank 0 decides which items are reported
+  string keys;
+  if (comm->getRank() == 0)
+    for (auto iter : itemMap_)
+      keys += iter.first + '\n';
+  int len = keys.size();
+  Teuchos::broadcast<int, int>(*comm, 0, 1, &len);
+  keys.resize(len);
+  if (len > 0)
+    Teuchos::broadcast<int, char>(*comm, 0, len, &keys[0]);
+
+  std::vector<key_type> names;
+  for (std::size_t b = 0, e; b < keys.size(); b = e + 1) {
+    e = keys.find('\n', b);
+    names.push_back(keys.substr(b, e - b));
+  }
+
+  const int n = names.size();
+  if (n == 0) return stats;
+  std::vector<double> local(n), lo(n), hi(n), sum(n);
+  for (int i = 0; i < n; ++i) {
+    auto pos = itemMap_.find(names[i]);
+    local[i] = pos == itemMap_.end() ? 0.0 : getNumericValue(*pos->second);
+  }
+  Teuchos::reduceAll<int, double>(*comm, Teuchos::REDUCE_MIN, n, &local[0], &lo[0]);
+  Teuchos::reduceAll<int, double>(*comm, Teuchos::REDUCE_MAX, n, &local[0], &hi[0]);
+  Teuchos::reduceAll<int, double>(*comm, Teuchos::REDUCE_SUM, n, &local[0], &sum[0]);
+
+  const double nprocs = comm->getSize();
+  for (int i = 0; i < n; ++i) {
+    RankStats& st = stats[names[i]];
+    st.min = lo[i];
+    st.avg = sum[i] / nprocs;
+    st.max = hi[i];
+  }
+  return stats;
+}
+
 template<class MonitoredType>
 inline void MonitorBase<MonitoredType>::summarize (std::ostream& out) {
   // MPI should be initialized before this call
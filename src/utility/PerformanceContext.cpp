@@ -8,8 +8,41 @@
 
 #include "PerformanceContext.hpp"
 
+#include <Teuchos_TimeMonitor.hpp>
+#include <fstream>
+#include <iomanip>
+
 namespace util {
 
+namespace {
+
+string jsonString (const string& s) {
+  string r = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') r += '\\';
+    if (c == '\n') { r += "\\n"; continue; }
+    r += c;
+  }
+  return r + "\"";
+}
+
+template<class StatsMap>
+void writeStats (std::ostream& out, const string& name,
+                 const StatsMap& stats) {
+  out << "  " << jsonString(name) << ": {";
+  const char* sep = "\n";
+  for (auto&& item : stats) {
+    out << sep << "    " << jsonString(item.first)
+        << ": {\"min\": " << item.second.min
+        << ", \"avg\": " << item.second.avg
+        << ", \"max\": " << item.second.max << "}";
+    sep = ",\n";
+  }
+  out << "\n  }";
+}
+
+}
+
 PerformanceContext PerformanceContext::instance_ = PerformanceContext();
 
 PerformanceContext& PerformanceContext::instance () {
@@ -32,4 +65,53 @@ void PerformanceContext::summarizeAll (std::ostream& out) {
   summarizeAll(comm.ptr(), out);
 }
 
+void PerformanceContext::writeJSON (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+  // All reductions are collective; only rank 0 writes.
+  const TimeMonitor::stats_map timers = timeMonitor_.reduceOverRanks(comm);
+  const CounterMonitor::stats_map counters =
+      counterMonitor_.reduceOverRanks(comm);
+
+  Teuchos::stat_map_type teuchosStats;
+  std::vector<std::string> statNames;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(teuchosStats, statNames,
+      comm, Teuchos::Union);
+
+  if (comm->getRank() != 0) return;
+
+  int iMin = -1, iAvg = -1, iMax = -1;
+  for (int i = 0; i < static_cast<int>(statNames.size()); ++i) {
+    if (statNames[i] == "MinOverProcs") iMin = i;
+    else if (statNames[i] == "MeanOverProcs") iAvg = i;
+    else if (statNames[i] == "MaxOverProcs") iMax = i;
+  }
+
+  out << std::setprecision(17);
+  out << "{\n  \"ranks\": " << comm->getSize() << ",\n";
+  writeStats(out, "timers", timers);
+  out << ",\n";
+  writeStats(out, "counters", counters);
+  out << ",\n  \"teuchos timers\": {";
+  const char* sep = "\n";
+  if (iMin >= 0 && iAvg >= 0 && iMax >= 0) {
+    for (auto&& item : teuchosStats) {
+      const std::vector<std::pair<double, double> >& st = item.second;
+      out << sep << "    " << jsonString(item.first)
+          << ": {\"min\": " << st[iMin].first
+          << ", \"avg\": " << st[iAvg].first
+          << ", \"max\": " << st[iMax].first
+          << ", \"calls\": " << st[iAvg].second << "}";
+      sep = ",\n";
+    }
+  }
+  out << "\n  }\n}" << std::endl;
+}
+
+void PerformanceContext::writeJSON (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, const std::string& filename) {
+  std::ofstream file;
+  if (comm->getRank() == 0) file.open(filename.c_str());
+  writeJSON(comm, file);
+}
+
 }
@@ -29,6 +29,26 @@ public:
                      std::ostream &out = std::cout);
   void summarizeAll (std::ostream &out = std::cout);
 
+  //! Writes timer and counter statistics as JSON on rank 0 (collective).
+  /*!
+   * Besides the monitors of this context, the JSON also holds every
+   * Teuchos::TimeMonitor timer (this includes the per-evaluator timers that
+   * Phalanx creates when built with its time monitor) with call counts.
+   */
+  void writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out);
+  void writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  const std::string &filename);
+
+  //! Hot-path regions (see ProfileGuard) are only recorded when enabled.
+  void setEnabled (bool enabled) {
+    enabled_ = enabled;
+  }
+
+  bool isEnabled () const {
+    return enabled_;
+  }
+
   TimeMonitor& timeMonitor () {
     return timeMonitor_;
   }
@@ -44,6 +64,8 @@ public:
 private:
   
   static PerformanceContext instance_;
+
+  bool            enabled_ = false;
   
   TimeMonitor     timeMonitor_;
   CounterMonitor  counterMonitor_;
@@ -0,0 +1,68 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_PROFILEGUARD_HPP
+#define UTIL_PROFILEGUARD_HPP
+
+/**
+ *  \file ProfileGuard.hpp
+ *  
+ *  \brief Scoped hot-path region recorded in the PerformanceContext.
+ */
+
+#include "PerformanceContext.hpp"
+
+namespace util {
+
+/**
+ *  \brief Times a region and counts its calls and bytes touched.
+ *  
+ *  The region's time goes to the timer named \c region; calls and bytes go
+ *  to the counters "<region> [calls]" and "<region> [bytes]". Does nothing
+ *  unless the PerformanceContext is enabled. Not thread safe: guard regions
+ *  from the thread that drives the fill.
+ */
+class ProfileGuard {
+public:
+
+  explicit ProfileGuard (const string& region, Counter::counter_type bytes = 0) {
+    if (PerformanceContext::instance().isEnabled())
+      start(region, bytes);
+  }
+
+  //! Region "<category> [<group>]"; the name is only built when enabled.
+  ProfileGuard (const char* category, const string& group,
+                Counter::counter_type bytes) {
+    if (PerformanceContext::instance().isEnabled())
+      start(string(category) + " [" + group + "]", bytes);
+  }
+
+  ~ProfileGuard () {
+    if (timer_.is_null()) return;
+    timer_->stop();
+  }
+
+private:
+
+  void start (const string& region, Counter::counter_type bytes) {
+    PerformanceContext& context = PerformanceContext::instance();
+    CounterMonitor& counters = context.counterMonitor();
+    ++(*counters[region + " [calls]"]);
+    *counters[region + " [bytes]"] += bytes;
+    timer_ = context.timeMonitor()[region];
+    timer_->start();
+  }
+
+  ProfileGuard (const ProfileGuard&);
+  ProfileGuard& operator= (const ProfileGuard&);
+
+  Teuchos::RCP<Teuchos::Time> timer_;
+};
+}
+
+#endif  // UTIL_PROFILEGUARD_HPP
@@ -21,5 +21,8 @@ string TimeMonitor::getStringValue (const monitored_type& val) {
   return to_string(static_cast<long double>(val.totalElapsedTime()));
 }
 
+double TimeMonitor::getNumericValue (const monitored_type& val) {
+  return val.totalElapsedTime();
 }
 
+}